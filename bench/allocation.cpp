@@ -0,0 +1,92 @@
+#include <allocation.hpp>
+#include <array>
+#include <bench.hpp>
+#include <cstring>
+#include <random>
+
+// allocators under typical patterns, every block is touched once:
+// - lifo: 64 blocks of 16 to 512 bytes freed in reverse (nested scopes, scratch buffers)
+// - temporaries: 64 long-lived 32 byte blocks, each followed by a 1KB temporary freed right away (parsers, builders)
+// - spill: 64 blocks of 128 bytes, twice what the 4KB stack in front of `fallback_allocator` holds
+
+using namespace gstd;
+
+namespace {
+    constexpr size_t blocks = 64;
+
+    std::array<size_t, blocks> const sizes = [] {
+        std::array<size_t, blocks> sizes;
+        std::mt19937 rng{42};
+        for(auto & size : sizes)
+            size = 16 + rng() % 497;
+        return sizes;
+    }();
+
+    void touch(allocation::allocation_result a) noexcept
+    {
+        if(a)
+            std::memset(a.ptr, 0, 1);
+        bench::do_not_optimize(a.ptr);
+    }
+
+    template<typename Alloc>
+    void lifo(Alloc & alloc) noexcept
+    {
+        allocation::allocation_result held[blocks];
+        for(size_t i = 0; i < blocks; ++i)
+            touch(held[i] = alloc.allocate(sizes[i]));
+        for(size_t i = blocks; i--;)
+            alloc.deallocate(held[i]);
+    }
+
+    template<typename Alloc>
+    void temporaries(Alloc & alloc) noexcept
+    {
+        allocation::allocation_result held[blocks];
+        for(size_t i = 0; i < blocks; ++i) {
+            touch(held[i] = alloc.allocate(32));
+            auto temporary = alloc.allocate(1024);
+            touch(temporary);
+            alloc.deallocate(temporary);
+        }
+        for(size_t i = blocks; i--;)
+            alloc.deallocate(held[i]);
+    }
+
+    template<typename Alloc>
+    void spill(Alloc & alloc) noexcept
+    {
+        allocation::allocation_result held[blocks];
+        for(size_t i = 0; i < blocks; ++i)
+            touch(held[i] = alloc.allocate(128));
+        for(size_t i = blocks; i--;)
+            alloc.deallocate(held[i]);
+    }
+
+    template<typename Alloc>
+    void suite(bench::runner & runner, char const * name, Alloc & alloc, bool spills)
+    {
+        std::string prefix = name;
+        runner.run(prefix + "/lifo", [&] { lifo(alloc); });
+        runner.run(prefix + "/temporaries", [&] { temporaries(alloc); });
+        if(spills)
+            runner.run(prefix + "/spill", [&] { spill(alloc); });
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    auto c = allocation::c_allocator;
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{1 << 16}};
+    allocation::stack_allocator<1 << 16> stack;
+    allocation::fallback_allocator<allocation::stack_allocator<4096>, allocation::c_allocator_type> fallback;
+    allocation::tlsf_allocator<allocation::c_allocator_type> tlsf{allocation::arena_size{1 << 16}};
+
+    suite(runner, "c_allocator", c, true);
+    suite(runner, "arena_allocator", arena, false);
+    suite(runner, "stack_allocator", stack, false);
+    suite(runner, "fallback_allocator", fallback, true);
+    suite(runner, "tlsf_allocator", tlsf, true);
+    return runner.finish();
+}
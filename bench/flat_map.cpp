@@ -0,0 +1,40 @@
+#include <algorithm>
+#include <bench.hpp>
+#include <containers.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+// lookups of random keys in a table of 1M 32-bit keys: std::map, std::lower_bound on a sorted vector and
+// containers::flat_map
+
+using namespace gstd;
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    std::mt19937 rng{42};
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> entries(1 << 20);
+    for(auto & [key, value] : entries) {
+        key   = static_cast<std::uint32_t>(rng());
+        value = key / 2;
+    }
+    std::vector<std::uint32_t> queries(10'000'000);
+    for(auto & q : queries)
+        q = entries[rng() % entries.size()].first;
+
+    std::map<std::uint32_t, std::uint32_t> tree(entries.begin(), entries.end());
+    std::vector<std::uint32_t> sorted;
+    for(auto & [key, value] : tree)
+        sorted.push_back(key);
+    containers::flat_map<std::uint32_t, std::uint32_t> flat{entries};
+
+    // one lookup per iteration, cycling through the queries
+    size_t next = 0;
+    auto query  = [&] { return queries[next++ % queries.size()]; };
+    runner.run("std::map", [&] { return tree.find(query())->second; });
+    runner.run("std::lower_bound", [&] { return *std::lower_bound(sorted.begin(), sorted.end(), query()); });
+    runner.run("containers::flat_map", [&] { return (*flat.find(query())).second; });
+    return runner.finish();
+}
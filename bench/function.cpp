@@ -0,0 +1,35 @@
+#include <bench.hpp>
+#include <cstdint>
+#include <functional>
+#include <utility/function.hpp>
+#include <vector>
+
+// a queue of 1000 callbacks capturing 24 bytes (past `std::function`'s inline buffer) filled and run with
+// std::function and utility::function
+
+using namespace gstd;
+
+template<typename Function>
+static std::int64_t run_queue(std::vector<Function> & queue)
+{
+    std::int64_t sum = 0;
+    queue.clear();
+    for(std::int64_t i = 0; i < 1000; ++i)
+        queue.emplace_back([i, j = i * 2, k = i * 3](std::int64_t & out) { out += i + j + k; });
+    for(auto & callback : queue)
+        callback(sum);
+    return sum;
+}
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    std::vector<std::function<void(std::int64_t &)>> std_queue;
+    std::vector<utility::function<void(std::int64_t &)>> gstd_queue;
+    std_queue.reserve(1000);
+    gstd_queue.reserve(1000);
+
+    runner.run("callback queue std::function", [&] { return run_queue(std_queue); });
+    runner.run("callback queue utility::function", [&] { return run_queue(gstd_queue); });
+    return runner.finish();
+}
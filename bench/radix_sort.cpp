@@ -0,0 +1,30 @@
+#include <algorithm>
+#include <allocation.hpp>
+#include <bench.hpp>
+#include <cstdint>
+#include <parallel.hpp>
+#include <random>
+#include <ranges.hpp>
+#include <vector>
+
+// 10M random 64-bit keys sorted with std::sort, ranges::radix_sort (scratch space from an arena) and
+// parallel::radix_sort
+
+using namespace gstd;
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    std::vector<std::uint64_t> input(10'000'000);
+    std::mt19937_64 rng{42};
+    for(auto & x : input)
+        x = rng();
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{input.size() * 8 + (1 << 17)}};
+
+    auto setup = [&] { return input; };
+
+    runner.run("std::sort", setup, [](auto & v) { std::sort(v.begin(), v.end()); });
+    runner.run("ranges::radix_sort", setup, [&](auto & v) { ranges::radix_sort(v, arena); });
+    runner.run("parallel::radix_sort", setup, [&](auto & v) { parallel::radix_sort(v, arena); });
+    return runner.finish();
+}
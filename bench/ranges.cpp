@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <bench.hpp>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <random>
+#include <ranges.hpp>
+#include <ranges>
+#include <vector>
+
+// the gstd::ranges CPOs next to their std::ranges counterparts: access (begin/end, size, empty, data) over many small
+// containers, ranges::to, and the algorithms over 1M integers
+
+using namespace gstd;
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    std::mt19937 rng{42};
+
+    std::vector<std::vector<int>> vectors(1024);
+    std::vector<std::list<int>> lists(1024);
+    std::vector<std::deque<int>> deques(1024);
+    for(size_t i = 0; i < vectors.size(); ++i) {
+        vectors[i].resize(rng() % 16);
+        lists[i].resize(vectors[i].size());
+        deques[i].resize(vectors[i].size());
+    }
+
+    runner.run("begin/end vector gstd", [&] {
+        std::int64_t sum = 0;
+        for(auto & v : vectors)
+            for(auto it = ranges::begin(v); it != ranges::end(v); ++it)
+                sum += *it;
+        return sum;
+    });
+    runner.run("begin/end vector std", [&] {
+        std::int64_t sum = 0;
+        for(auto & v : vectors)
+            for(auto it = std::ranges::begin(v); it != std::ranges::end(v); ++it)
+                sum += *it;
+        return sum;
+    });
+    runner.run("size list gstd", [&] {
+        size_t sum = 0;
+        for(auto & l : lists)
+            sum += ranges::size(l);
+        return sum;
+    });
+    runner.run("size list std", [&] {
+        size_t sum = 0;
+        for(auto & l : lists)
+            sum += std::ranges::size(l);
+        return sum;
+    });
+    runner.run("size take gstd", [&] {
+        size_t sum = 0;
+        for(auto & v : vectors)
+            sum += ranges::size(v | ranges::views::take(8));
+        return sum;
+    });
+    runner.run("size take std", [&] {
+        size_t sum = 0;
+        for(auto & v : vectors)
+            sum += std::ranges::size(v | std::views::take(8));
+        return sum;
+    });
+    runner.run("empty deque gstd", [&] {
+        size_t empty = 0;
+        for(auto & d : deques)
+            empty += ranges::empty(d);
+        return empty;
+    });
+    runner.run("empty deque std", [&] {
+        size_t empty = 0;
+        for(auto & d : deques)
+            empty += std::ranges::empty(d);
+        return empty;
+    });
+    runner.run("data vector gstd", [&] {
+        std::uintptr_t sum = 0;
+        for(auto & v : vectors)
+            sum += reinterpret_cast<std::uintptr_t>(ranges::data(v));
+        return sum;
+    });
+    runner.run("data vector std", [&] {
+        std::uintptr_t sum = 0;
+        for(auto & v : vectors)
+            sum += reinterpret_cast<std::uintptr_t>(std::ranges::data(v));
+        return sum;
+    });
+
+    std::vector<int> numbers(1 << 20);
+    for(auto & x : numbers)
+        x = static_cast<int>(rng() % 1000);
+    auto copy   = numbers;
+    auto square = [](int x) { return x * x; };
+
+    runner.run("to vector gstd", [&] { return ranges::to<std::vector>(numbers | ranges::views::transform(square)); });
+    runner.run("to vector std", [&] {
+        std::vector<int> v;
+        v.reserve(numbers.size());
+        std::ranges::copy(numbers | std::views::transform(square), std::back_inserter(v));
+        return v;
+    });
+    runner.run("find gstd", [&] { return ranges::find(numbers, 1000) == numbers.end(); });
+    runner.run("find std", [&] { return std::ranges::find(numbers, 1000) == numbers.end(); });
+    runner.run("count gstd", [&] { return ranges::count(numbers, 7); });
+    runner.run("count std", [&] { return std::ranges::count(numbers, 7); });
+    runner.run("equal gstd", [&] { return ranges::equal(numbers, copy); });
+    runner.run("equal std", [&] { return std::ranges::equal(numbers, copy); });
+    runner.run("max gstd", [&] { return ranges::max(numbers); });
+    runner.run("max std", [&] { return std::ranges::max(numbers); });
+    return runner.finish();
+}
@@ -0,0 +1,66 @@
+#include <bench.hpp>
+#include <cstdint>
+#include <random>
+#include <ranges>
+#include <ranges.hpp>
+#include <vector>
+
+// sum of the squares of the odd elements among the first half of the input and a pairwise dot product,
+// each written as a hand-written loop, a gstd::ranges pipeline and the equivalent std::views pipeline
+
+using namespace gstd;
+
+int main(int argc, char ** argv)
+{
+    bench::runner runner{argc, argv};
+    std::vector<std::int64_t> a(1 << 22), b(1 << 22);
+    std::mt19937_64 rng{42};
+    for(auto & x : a)
+        x = static_cast<std::int64_t>(rng() % 1000);
+    for(auto & x : b)
+        x = static_cast<std::int64_t>(rng() % 1000);
+    auto const half = static_cast<std::ptrdiff_t>(a.size() / 2);
+    auto odd        = [](std::int64_t x) { return x % 2 != 0; };
+    auto square     = [](std::int64_t x) { return x * x; };
+
+    runner.run("filter/transform hand", [&] {
+        std::int64_t sum = 0;
+        for(std::ptrdiff_t i = 0; i < half; ++i)
+            if(odd(a[static_cast<size_t>(i)]))
+                sum += square(a[static_cast<size_t>(i)]);
+        return sum;
+    });
+    runner.run("filter/transform gstd", [&] {
+        std::int64_t sum = 0;
+        for(auto x : a | ranges::views::take(half) | ranges::views::filter(odd) | ranges::views::transform(square))
+            sum += x;
+        return sum;
+    });
+    runner.run("filter/transform std", [&] {
+        std::int64_t sum = 0;
+        for(auto x : a | std::views::take(half) | std::views::filter(odd) | std::views::transform(square))
+            sum += x;
+        return sum;
+    });
+
+    runner.run("zip dot hand", [&] {
+        std::int64_t sum = 0;
+        for(size_t i = 0; i < a.size(); ++i)
+            sum += a[i] * b[i];
+        return sum;
+    });
+    runner.run("zip dot gstd", [&] {
+        std::int64_t sum = 0;
+        for(auto [x, y] : ranges::views::zip(a, b))
+            sum += x * y;
+        return sum;
+    });
+    runner.run("zip dot std", [&] {
+        // no std::views::zip before C++23 libraries, pair indices with iota instead
+        std::int64_t sum = 0;
+        for(auto i : std::views::iota(size_t{0}, a.size()))
+            sum += a[i] * b[i];
+        return sum;
+    });
+    return runner.finish();
+}
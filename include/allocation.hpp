@@ -2,12 +2,20 @@
 #define GSTD_ALLOCATION_HPP
 
 // TODO fix alignment everywhere!!!
+#include "allocation/aligned.hpp"
 #include "allocation/arena_allocator.hpp"
 #include "allocation/base.hpp"
+#include "allocation/buddy_allocator.hpp"
 #include "allocation/c_allocator.hpp"
 #include "allocation/create_destroy.hpp"
+#include "allocation/epoch.hpp"
 #include "allocation/fallback_allocator.hpp"
-// TODO switch-based-on-size allocator
-// TODO switch-based-on-size allocator
+#include "allocation/free_list.hpp"
+#include "allocation/offset_ptr.hpp"
+#include "allocation/segregator.hpp"
+#include "allocation/shared_memory_allocator.hpp"
+#include "allocation/stack_allocator.hpp"
+#include "allocation/std_adapter.hpp"
+#include "allocation/tlsf_allocator.hpp"
 
 #endif // GSTD_ALLOCATION_HPP
@@ -0,0 +1,43 @@
+#ifndef GSTD_ALLOCATION_ALIGNED_HPP
+#define GSTD_ALLOCATION_ALIGNED_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include "allocation/base.hpp"
+
+namespace gstd::allocation {
+    // `ptr` is aligned as requested, `allocation` has to be deallocated
+    struct aligned_allocation {
+        void * ptr;
+        allocation_result allocation;
+
+        [[nodiscard]] constexpr explicit operator bool() const noexcept { return ptr; }
+    };
+
+    // `ptr` rounded up to a multiple of `alignment` (a power of two)
+    [[nodiscard]] inline void * align_up(void * ptr, size_t alignment) noexcept
+    {
+        auto address = reinterpret_cast<std::uintptr_t>(ptr);
+        auto aligned = (address + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        return static_cast<char *>(ptr) + (aligned - address);
+    }
+
+    // `size` bytes aligned to `alignment` (a power of two) from `alloc`, over-allocating for over-alignment
+    // allocators are assumed to return memory aligned for `std::max_align_t` (requests are rounded up to keep bump
+    // allocators that way)
+    template<allocator Alloc>
+    [[nodiscard]] aligned_allocation allocate_aligned(Alloc & alloc, size_t size, size_t alignment) noexcept
+    {
+        constexpr size_t natural = alignof(std::max_align_t);
+        auto extra               = alignment > natural ? alignment - natural : 0;
+        if(size > std::numeric_limits<size_t>::max() - extra - natural)
+            return {nullptr, no_allocation};
+        auto allocation = alloc.allocate((size + extra + natural - 1) / natural * natural);
+        if(!allocation)
+            return {nullptr, no_allocation};
+        return {align_up(allocation.ptr, alignment), allocation};
+    }
+}
+
+#endif
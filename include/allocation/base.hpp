@@ -3,6 +3,7 @@
 
 #include <concepts>
 #include <type_traits>
+#include <utility>
 
 namespace gstd::allocation {
     using size_t = decltype(sizeof(nullptr));
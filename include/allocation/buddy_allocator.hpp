@@ -0,0 +1,202 @@
+#ifndef GSTD_ALLOCATION_BUDDY_ALLOCATOR_HPP
+#define GSTD_ALLOCATION_BUDDY_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "allocation/aligned.hpp"
+#include "allocation/arena_allocator.hpp"
+#include "allocation/base.hpp"
+
+// Binary buddy allocator over a single region from `Parent`: blocks are `MinBlock` bytes times a power of two (the
+// order) and aligned to their size. Every order has a bitmap of its free blocks and a summary of its non-empty words,
+// allocation takes the lowest one of the smallest order that fits and splits it, freeing merges a block with its buddy
+// as long as that's free too. Finding the lowest free block of an order takes two `countr_zero`s while it has at most
+// 64 * 64 blocks (beyond that, summary words of 4096 blocks each are scanned from a per-order hint), so both take
+// O(orders) for regions of up to 4096 `MinBlock`s.
+// Regions of other than a power of two blocks are covered by blocks of decreasing order, which never merge.
+
+namespace gstd::allocation {
+    template<allocator Parent, size_t MinBlock = 4096>
+    class buddy_allocator {
+        static_assert(std::has_single_bit(MinBlock) && MinBlock >= 16);
+
+        static constexpr size_t max_orders = 64;
+        static constexpr size_t word_bits  = 64;
+      public:
+        // the region is `size` bytes rounded down to whole `MinBlock`s from `Parent{args...}`
+        template<typename... Args>
+        explicit(sizeof...(Args) == 0) buddy_allocator(arena_size size, Args &&... args) noexcept(
+          std::is_nothrow_constructible_v<Parent, Args...>
+        )
+            : _parent(static_cast<Args &&>(args)...)
+        {
+            auto blocks = static_cast<size_t>(size) / MinBlock;
+            if(!blocks)
+                return;
+            _orders = static_cast<size_t>(std::bit_width(blocks));
+            size_t words = 0;
+            for(size_t order = 0; order < _orders; ++order)
+                words += words_of(blocks >> order) + words_of(words_of(blocks >> order));
+            _bitmap_allocation = _parent.allocate(words * sizeof(std::uint64_t));
+            if(!_bitmap_allocation)
+                return;
+            _region = allocate_aligned(_parent, blocks * MinBlock, MinBlock);
+            if(!_region) {
+                _parent.deallocate(std::exchange(_bitmap_allocation, no_allocation));
+                return;
+            }
+            _blocks = blocks;
+            std::memset(_bitmap_allocation.ptr, 0, words * sizeof(std::uint64_t));
+            auto * bitmap = static_cast<std::uint64_t *>(_bitmap_allocation.ptr);
+            for(size_t order = 0; order < _orders; ++order) {
+                _bitmaps[order] = bitmap;
+                bitmap += words_of(blocks >> order);
+                _summaries[order] = bitmap;
+                bitmap += words_of(words_of(blocks >> order));
+            }
+            // the largest blocks that fit, in decreasing order
+            for(size_t order = _orders, offset = 0; order--;)
+                if(offset + (size_t{1} << order) <= blocks) {
+                    set(order, offset >> order);
+                    offset += size_t{1} << order;
+                }
+        }
+
+        buddy_allocator(buddy_allocator && other) noexcept(std::is_nothrow_move_constructible_v<Parent>)
+            : _parent(std::move(other._parent)), _region{std::exchange(other._region, {nullptr, no_allocation})}
+            , _bitmap_allocation{std::exchange(other._bitmap_allocation, no_allocation)}
+            , _blocks{std::exchange(other._blocks, 0)}, _orders{std::exchange(other._orders, 0)}
+        {
+            std::copy_n(other._bitmaps, max_orders, _bitmaps);
+            std::copy_n(other._summaries, max_orders, _summaries);
+            std::copy_n(other._free, max_orders, _free);
+            std::copy_n(other._hints, max_orders, _hints);
+        }
+
+        buddy_allocator(buddy_allocator const &) = delete;
+        void operator=(buddy_allocator const &)  = delete;
+
+        ~buddy_allocator()
+        {
+            if(_region)
+                _parent.deallocate(_region.allocation);
+            if(_bitmap_allocation)
+                _parent.deallocate(_bitmap_allocation);
+        }
+
+        // the size is that of the block, `MinBlock` times a power of two
+        [[nodiscard]] allocation_result allocate(size_t size) noexcept
+        {
+            if(size > _blocks * MinBlock)
+                return no_allocation;
+            auto order = order_of(size);
+            auto from  = order;
+            while(from < _orders && !_free[from])
+                ++from;
+            if(from >= _orders)
+                return no_allocation;
+            auto index = take(from);
+            // the left half is split further, the right one is free
+            for(; from > order; --from)
+                set(from - 1, (index <<= 1) | 1);
+            return {static_cast<char *>(_region.ptr) + (index << order) * MinBlock, MinBlock << order};
+        }
+
+        void deallocate(allocation_result allocation) noexcept
+        {
+            if(!allocation.ptr)
+                return;
+            auto order = order_of(allocation.size);
+            auto index = static_cast<size_t>(static_cast<char *>(allocation.ptr) - static_cast<char *>(_region.ptr))
+                         / MinBlock >> order;
+            for(; order + 1 < _orders && test(order, index ^ 1); ++order, index >>= 1)
+                clear(order, index ^ 1);
+            set(order, index);
+        }
+
+        [[nodiscard]] bool owns(allocation_result allocation) const noexcept
+        {
+            auto * ptr   = static_cast<char const *>(allocation.ptr);
+            auto * begin = static_cast<char const *>(_region.ptr);
+            return begin && begin <= ptr && ptr < begin + _blocks * MinBlock;
+        }
+
+        // number of free bytes (not necessarily contiguous)
+        [[nodiscard]] size_t available() const noexcept
+        {
+            size_t blocks = 0;
+            for(size_t order = 0; order < _orders; ++order)
+                blocks += _free[order] << order;
+            return blocks * MinBlock;
+        }
+      private:
+        [[nodiscard]] static constexpr size_t words_of(size_t bits) noexcept
+        {
+            return (bits + word_bits - 1) / word_bits;
+        }
+
+        [[nodiscard]] static size_t order_of(size_t size) noexcept
+        {
+            auto blocks = std::max((size + MinBlock - 1) / MinBlock, size_t{1});
+            return static_cast<size_t>(std::bit_width(blocks - 1));
+        }
+
+        [[nodiscard]] bool test(size_t order, size_t index) const noexcept
+        {
+            if(index >= _blocks >> order)
+                return false;
+            return _bitmaps[order][index / word_bits] >> (index % word_bits) & 1;
+        }
+
+        void set(size_t order, size_t index) noexcept
+        {
+            auto w = index / word_bits;
+            if(!_bitmaps[order][w]) {
+                _summaries[order][w / word_bits] |= std::uint64_t{1} << (w % word_bits);
+                _hints[order] = std::min(_hints[order], w / word_bits);
+            }
+            _bitmaps[order][w] |= std::uint64_t{1} << (index % word_bits);
+            ++_free[order];
+        }
+
+        void clear(size_t order, size_t index) noexcept
+        {
+            auto w = index / word_bits;
+            if(!(_bitmaps[order][w] &= ~(std::uint64_t{1} << (index % word_bits))))
+                _summaries[order][w / word_bits] &= ~(std::uint64_t{1} << (w % word_bits));
+            --_free[order];
+        }
+
+        // removes the lowest free block of `order`, of which there is at least one
+        [[nodiscard]] size_t take(size_t order) noexcept
+        {
+            auto * summary = _summaries[order];
+            auto s         = _hints[order];
+            while(!summary[s])
+                ++s;
+            _hints[order] = s;
+            auto w        = s * word_bits + static_cast<size_t>(std::countr_zero(summary[s]));
+            auto index    = w * word_bits + static_cast<size_t>(std::countr_zero(_bitmaps[order][w]));
+            clear(order, index);
+            return index;
+        }
+
+        [[no_unique_address]] Parent _parent;
+        aligned_allocation _region{nullptr, no_allocation};
+        allocation_result _bitmap_allocation = no_allocation;
+        size_t _blocks                       = 0;
+        size_t _orders                       = 0;
+        std::uint64_t * _bitmaps[max_orders]{};
+        // bit `w` is set while word `w` of the order's bitmap is non-zero
+        std::uint64_t * _summaries[max_orders]{};
+        size_t _free[max_orders]{};
+        // no free block of the order is in a summary word before this one
+        size_t _hints[max_orders]{};
+    };
+}
+
+#endif
@@ -2,6 +2,7 @@
 #define GSTD_ALLOCATION_BUFFER_ALLOCATOR_HPP
 
 #include <bit>
+#include <cstdint>
 #include <utility>
 #include "allocation/base.hpp"
 
@@ -43,7 +44,10 @@ namespace gstd::allocation::_impl {
             return begin <= ptr && ptr < end;
         }
       private:
-        constexpr allocation_result _allocation() noexcept { return static_cast<Self *>(this)->get_allocation(); }
+        constexpr allocation_result _allocation() const noexcept
+        {
+            return static_cast<Self const *>(this)->get_allocation();
+        }
 
         void * _top;
     };
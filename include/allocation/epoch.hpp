@@ -0,0 +1,171 @@
+#ifndef GSTD_ALLOCATION_EPOCH_HPP
+#define GSTD_ALLOCATION_EPOCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+#include "utility/thread_slots.hpp"
+
+// Epoch-based reclamation: readers `pin` the domain for as long as they hold pointers into a lock-free structure,
+// which only publishes the current epoch in a per-thread slot (a store and a fence, no read-modify-write). Blocks
+// unlinked from the structure are `retire`d into per-thread limbo lists, one per epoch, and handed back to the
+// allocator a whole list at a time once the epoch has advanced twice, ie. every thread pinned at the time has unpinned.
+// The epoch only advances once no pinned thread lags behind it, which is checked every `collect_interval` retirements.
+
+namespace gstd::allocation {
+    namespace _impl::epoch {
+        struct retired {
+            void * ptr;
+            size_t size;
+            void (*destroy)(void *) noexcept;
+        };
+
+        // retired while the global epoch was `epoch`
+        struct limbo {
+            std::uint64_t epoch = 0;
+            std::vector<retired> blocks;
+        };
+
+        // a thread's membership in a domain, taken over by the next thread to join once it has exited
+        struct alignas(64) participant {
+            // global epoch << 1 | pinned, only written by the owning thread
+            std::atomic<std::uint64_t> state{0};
+            std::atomic<bool> owned{true};
+            size_t depth   = 0;
+            size_t retired = 0;
+            limbo lists[3];
+            // immutable once published
+            participant * next = nullptr;
+        };
+
+        class domain_base {
+          public:
+            static constexpr size_t collect_interval = 64;
+
+            domain_base(domain_base const &)             = delete;
+            domain_base & operator=(domain_base const &) = delete;
+
+            void enter(participant & self) noexcept
+            {
+                if(self.depth++)
+                    return;
+                self.state.store(_epoch.load(std::memory_order_relaxed) << 1 | 1, std::memory_order_relaxed);
+                // orders the announcement before every read of the structure
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+            }
+
+            void leave(participant & self) noexcept
+            {
+                if(--self.depth)
+                    return;
+                self.state.store(self.state.load(std::memory_order_relaxed) & ~std::uint64_t{1},
+                                 std::memory_order_release);
+            }
+
+            void retire(participant & self, retired block);
+
+            // advances the epoch if possible and frees the calling thread's blocks retired at least two epochs ago
+            void collect(participant & self) noexcept;
+
+            [[nodiscard]] participant & self()
+            {
+                if(auto * self = utility::_impl::thread_slots::get(_id))
+                    return *static_cast<participant *>(self);
+                return add_participant();
+            }
+          protected:
+            using deallocate_fn = void (*)(domain_base & self, allocation_result allocation) noexcept;
+
+            explicit domain_base(deallocate_fn deallocate);
+            ~domain_base();
+
+            // frees every retired block, no thread may be pinned
+            void clear() noexcept;
+          private:
+            // registers the calling thread
+            [[nodiscard]] participant & add_participant();
+            void free(limbo & list) noexcept;
+
+            alignas(64) std::atomic<std::uint64_t> _epoch{0};
+            alignas(64) std::atomic<participant *> _participants{nullptr};
+            // the calling thread's participant is in `utility::_impl::thread_slots`
+            size_t _id;
+            deallocate_fn _deallocate;
+        };
+    }
+
+    // stateless allocators are held by value, any other `Alloc` is referred to and has to outlive the domain
+    // destroying the domain frees every retired block, no thread may be pinned by then
+    template<allocator Alloc = c_allocator_type>
+    class epoch_domain : _impl::epoch::domain_base {
+        static constexpr bool stateless = stateless_allocator<Alloc>;
+      public:
+        // keeps the blocks retired from now on alive until it's destroyed, may be nested
+        class [[nodiscard]] guard {
+          public:
+            explicit guard(epoch_domain & domain) : _domain{domain}, _self{domain.self()} { _domain.enter(_self); }
+
+            guard(guard const &)             = delete;
+            guard & operator=(guard const &) = delete;
+
+            ~guard() { _domain.leave(_self); }
+          private:
+            epoch_domain & _domain;
+            _impl::epoch::participant & _self;
+        };
+
+        epoch_domain()
+        requires stateless_allocator<Alloc>
+            : domain_base{&deallocate}
+        {}
+
+        explicit epoch_domain(Alloc & alloc)
+        requires (!stateless_allocator<Alloc>)
+            : domain_base{&deallocate}, _alloc{std::addressof(alloc)}
+        {}
+
+        ~epoch_domain() { clear(); }
+
+        [[nodiscard]] guard pin() { return guard{*this}; }
+
+        // `allocation` (from the domain's allocator) is unreachable for threads pinning the domain from now on
+        void retire(allocation_result allocation)
+        {
+            domain_base::retire(self(), {allocation.ptr, allocation.size, nullptr});
+        }
+
+        // `object` (see `allocation::create`) is destroyed and deallocated once no thread can be reading it anymore
+        template<typename T>
+        requires std::is_nothrow_destructible_v<T>
+        void retire(creation_result<T> object)
+        {
+            auto destroy = [](void * ptr) noexcept { std::destroy_at(static_cast<T *>(ptr)); };
+            domain_base::retire(self(), {object.ptr, object.size, destroy});
+        }
+
+        // advances the epoch if possible and frees what the calling thread retired long enough ago
+        void collect() { domain_base::collect(self()); }
+
+        // the underlying allocator
+        [[nodiscard]] Alloc & get() noexcept
+        {
+            if constexpr(stateless)
+                return _alloc;
+            else
+                return *_alloc;
+        }
+      private:
+        static void deallocate(domain_base & self, allocation_result allocation) noexcept
+        {
+            static_cast<epoch_domain &>(self).get().deallocate(allocation);
+        }
+
+        [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc;
+    };
+}
+
+#endif
@@ -58,7 +58,8 @@ namespace gstd::allocation {
         {
             if(_primary.owns(allocation))
                 _primary.deallocate(allocation);
-            _fallback.deallocate(allocation);
+            else
+                _fallback.deallocate(allocation);
         }
 
         constexpr void deallocate(allocation_result allocation) const noexcept
@@ -66,7 +67,8 @@ namespace gstd::allocation {
         {
             if(_primary.owns(allocation))
                 _primary.deallocate(allocation);
-            _fallback.deallocate(allocation);
+            else
+                _fallback.deallocate(allocation);
         }
 
         constexpr allocation_result reallocate(allocation_result allocation, size_t size) noexcept
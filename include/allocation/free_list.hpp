@@ -0,0 +1,82 @@
+#ifndef GSTD_ALLOCATION_FREE_LIST_HPP
+#define GSTD_ALLOCATION_FREE_LIST_HPP
+
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/base.hpp"
+
+namespace gstd::allocation {
+    // requests of [Min, Max] bytes are served with blocks of `Max` bytes, up to `Capacity` deallocated blocks are kept
+    // for reuse instead of being handed back to `Parent`, anything else is forwarded to `Parent`
+    // blocks are plain `Parent` memory, so one may be deallocated into a different `free_list` of the same type
+    template<allocator Parent, size_t Min, size_t Max, size_t Capacity = 64>
+    class free_list {
+        static_assert(Min <= Max && sizeof(void *) <= Max);
+
+        struct node {
+            node * next;
+        };
+      public:
+        free_list() = default;
+
+        template<typename... Args>
+        requires std::is_constructible_v<Parent, Args...>
+        explicit constexpr free_list(std::in_place_t, Args &&... args) noexcept(
+          std::is_nothrow_constructible_v<Parent, Args...>
+        )
+            : _parent(static_cast<Args &&>(args)...)
+        {}
+
+        free_list(free_list const &)      = delete;
+        void operator=(free_list const &) = delete;
+
+        ~free_list()
+        {
+            while(_head)
+                _parent.deallocate({std::exchange(_head, _head->next), Max});
+        }
+
+        [[nodiscard]] allocation_result allocate(size_t size) noexcept
+        {
+            if(!fits(size))
+                return _parent.allocate(size);
+            if(_head) {
+                --_count;
+                return {std::exchange(_head, _head->next), Max};
+            }
+            if(auto allocation = _parent.allocate(Max))
+                return {allocation.ptr, Max};
+            return no_allocation;
+        }
+
+        void deallocate(allocation_result allocation) noexcept
+        {
+            if(!fits(allocation.size)) {
+                _parent.deallocate(allocation);
+            } else if(_count == Capacity) {
+                _parent.deallocate({allocation.ptr, Max});
+            } else {
+                _head = ::new(allocation.ptr) node{_head};
+                ++_count;
+            }
+        }
+
+        [[nodiscard]] bool owns(allocation_result allocation) const noexcept
+        requires ownership_aware_allocator<Parent>
+        {
+            return _parent.owns(allocation);
+        }
+
+        // number of blocks kept for reuse
+        [[nodiscard]] size_t cached() const noexcept { return _count; }
+      private:
+        [[nodiscard]] static constexpr bool fits(size_t size) noexcept { return Min <= size && size <= Max; }
+
+        [[no_unique_address]] Parent _parent;
+        node * _head  = nullptr;
+        size_t _count = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,123 @@
+#ifndef GSTD_ALLOCATION_OFFSET_PTR_HPP
+#define GSTD_ALLOCATION_OFFSET_PTR_HPP
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace gstd::allocation {
+    // pointer stored as the distance from itself to the pointee, so it stays valid wherever the memory holding both
+    // is mapped (eg. in `shared_memory_allocator`'s region)
+    // copying recomputes the distance, the distance 1 represents null (no object can start one byte after the
+    // pointer itself)
+    // the distance is computed on integers (wrapping around), pointer arithmetic between unrelated objects is undefined
+    template<typename T>
+    class offset_ptr {
+        static constexpr std::uintptr_t null = 1;
+      public:
+        using element_type    = T;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr offset_ptr() noexcept = default;
+
+        constexpr offset_ptr(std::nullptr_t) noexcept {}
+
+        offset_ptr(T * ptr) noexcept : _offset{distance(ptr)} {}
+
+        offset_ptr(offset_ptr const & other) noexcept : offset_ptr{other.get()} {}
+
+        template<typename U>
+        requires std::is_convertible_v<U *, T *>
+        offset_ptr(offset_ptr<U> const & other) noexcept : offset_ptr{static_cast<T *>(other.get())}
+        {}
+
+        offset_ptr & operator=(offset_ptr const & rhs) noexcept { return *this = rhs.get(); }
+
+        offset_ptr & operator=(T * ptr) noexcept
+        {
+            _offset = distance(ptr);
+            return *this;
+        }
+
+        [[nodiscard]] T * get() const noexcept
+        {
+            if(_offset == null)
+                return nullptr;
+            return reinterpret_cast<T *>(self() + _offset);
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept { return _offset != null; }
+
+        [[nodiscard]] std::add_lvalue_reference_t<T> operator*() const noexcept
+        requires (!std::is_void_v<T>)
+        {
+            return *get();
+        }
+
+        [[nodiscard]] T * operator->() const noexcept { return get(); }
+
+        [[nodiscard]] std::add_lvalue_reference_t<T> operator[](difference_type i) const noexcept
+        requires (!std::is_void_v<T>)
+        {
+            return get()[i];
+        }
+
+        offset_ptr & operator+=(difference_type n) noexcept { return *this = get() + n; }
+
+        offset_ptr & operator-=(difference_type n) noexcept { return *this = get() - n; }
+
+        offset_ptr & operator++() noexcept { return *this += 1; }
+
+        offset_ptr & operator--() noexcept { return *this -= 1; }
+
+        // returns a plain pointer, a temporary `offset_ptr` would only be valid where it is
+        T * operator++(int) noexcept
+        {
+            auto old = get();
+            ++*this;
+            return old;
+        }
+
+        T * operator--(int) noexcept
+        {
+            auto old = get();
+            --*this;
+            return old;
+        }
+
+        [[nodiscard]] friend T * operator+(offset_ptr const & ptr, difference_type n) noexcept { return ptr.get() + n; }
+
+        [[nodiscard]] friend T * operator-(offset_ptr const & ptr, difference_type n) noexcept { return ptr.get() - n; }
+
+        [[nodiscard]] friend difference_type operator-(offset_ptr const & lhs, offset_ptr const & rhs) noexcept
+        {
+            return lhs.get() - rhs.get();
+        }
+
+        [[nodiscard]] friend bool operator==(offset_ptr const & lhs, offset_ptr const & rhs) noexcept
+        {
+            return lhs.get() == rhs.get();
+        }
+
+        [[nodiscard]] friend bool operator==(offset_ptr const & lhs, std::nullptr_t) noexcept { return !lhs; }
+
+        [[nodiscard]] friend std::strong_ordering operator<=>(offset_ptr const & lhs, offset_ptr const & rhs) noexcept
+        {
+            return std::compare_three_way{}(lhs.get(), rhs.get());
+        }
+      private:
+        [[nodiscard]] std::uintptr_t self() const noexcept { return reinterpret_cast<std::uintptr_t>(this); }
+
+        [[nodiscard]] std::uintptr_t distance(T const * ptr) const noexcept
+        {
+            if(!ptr)
+                return null;
+            return reinterpret_cast<std::uintptr_t>(ptr) - self();
+        }
+
+        std::uintptr_t _offset = null;
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef GSTD_ALLOCATION_SEGREGATOR_HPP
+#define GSTD_ALLOCATION_SEGREGATOR_HPP
+
+#include <type_traits>
+#include "allocation/base.hpp"
+
+namespace gstd::allocation {
+    // requests of at most `Threshold` bytes go to `Small`, larger ones to `Large`
+    // allocations are told apart by their size, so `Small` mustn't report more than `Threshold` bytes
+    template<size_t Threshold, allocator Small, allocator Large>
+    class segregator {
+      public:
+        segregator() = default;
+
+        template<typename T = Small, typename U = Large>
+        constexpr segregator(T && small, U && large) noexcept(
+          std::is_nothrow_constructible_v<Small, T> && std::is_nothrow_constructible_v<Large, U>
+        )
+            : _small(static_cast<T &&>(small)), _large(static_cast<U &&>(large))
+        {}
+
+        [[nodiscard]] constexpr allocation_result allocate(size_t size) noexcept
+        {
+            return size <= Threshold ? _small.allocate(size) : _large.allocate(size);
+        }
+
+        constexpr void deallocate(allocation_result allocation) noexcept
+        {
+            if(allocation.size <= Threshold)
+                _small.deallocate(allocation);
+            else
+                _large.deallocate(allocation);
+        }
+
+        [[nodiscard]] constexpr bool owns(allocation_result allocation) const noexcept
+        requires (ownership_aware_allocator<Small> && ownership_aware_allocator<Large>)
+        {
+            return allocation.size <= Threshold ? _small.owns(allocation) : _large.owns(allocation);
+        }
+
+        [[nodiscard]] constexpr Small & small() noexcept { return _small; }
+
+        [[nodiscard]] constexpr Large & large() noexcept { return _large; }
+      private:
+        [[no_unique_address]] Small _small;
+        [[no_unique_address]] Large _large;
+    };
+}
+
+#endif
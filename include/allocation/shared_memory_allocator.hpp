@@ -0,0 +1,74 @@
+#ifndef GSTD_ALLOCATION_SHARED_MEMORY_ALLOCATOR_HPP
+#define GSTD_ALLOCATION_SHARED_MEMORY_ALLOCATOR_HPP
+
+#include <utility>
+#include "allocation/base.hpp"
+#include "allocation/offset_ptr.hpp"
+
+// `shared_memory_allocator` maps a named POSIX shared memory object (`shm_open`) and allocates from it. Requests are
+// rounded up to powers of two (at least 16 bytes) and served from lock-free free lists (one per size, tagged against
+// ABA) or a bump pointer, all of which live in the region itself (see src/shared_memory_allocator.cpp), so every
+// process mapping the region read-write may allocate and deallocate concurrently.
+// The region is mapped at different addresses in different processes: pointers stored in it have to be `offset_ptr`s,
+// and readers find the data through `root()`.
+
+namespace gstd::allocation {
+    enum class shared_access {
+        read_only, // `allocate` always fails, `deallocate` does nothing
+        read_write,
+    };
+
+    class shared_memory_allocator {
+      public:
+        // creates the region `name` (eg. "/tables") of `size` bytes, accessible by the current user only
+        // throws `std::system_error` if it already exists or can't be created or mapped
+        shared_memory_allocator(char const * name, size_t size);
+        // maps the existing region `name`
+        // throws `std::system_error` if it doesn't exist, can't be mapped or wasn't created by this allocator
+        explicit shared_memory_allocator(char const * name, shared_access access = shared_access::read_write);
+
+        shared_memory_allocator(shared_memory_allocator && other) noexcept
+            : _data{std::exchange(other._data, nullptr)}, _size{std::exchange(other._size, 0)}
+            , _writable{std::exchange(other._writable, false)}
+        {}
+
+        shared_memory_allocator & operator=(shared_memory_allocator && rhs) noexcept
+        {
+            std::swap(_data, rhs._data);
+            std::swap(_size, rhs._size);
+            std::swap(_writable, rhs._writable);
+            return *this;
+        }
+
+        // unmaps the region, which lives on until it has been `remove`d and unmapped everywhere
+        ~shared_memory_allocator();
+
+        // removes the name `name`, returns whether it existed
+        static bool remove(char const * name) noexcept;
+
+        [[nodiscard]] allocation_result allocate(size_t size) noexcept;
+        void deallocate(allocation_result allocation) noexcept;
+
+        [[nodiscard]] bool owns(allocation_result allocation) const noexcept
+        {
+            auto * ptr = static_cast<char const *>(allocation.ptr);
+            return _data <= ptr && ptr < _data + _size;
+        }
+
+        // the object readers start from (`nullptr` until set or once moved from), eg. the table the region was created
+        // for
+        [[nodiscard]] void * root() const noexcept;
+        // read-write only
+        void set_root(void * root) noexcept;
+
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+      private:
+        char * _data   = nullptr;
+        size_t _size   = 0;
+        bool _writable = false;
+    };
+
+    static_assert(ownership_aware_allocator<shared_memory_allocator>);
+}
+
+#endif
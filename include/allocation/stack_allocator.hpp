@@ -14,7 +14,7 @@ namespace gstd::allocation {
             stack_allocator_base(stack_allocator_base const &) = delete;
             void operator=(stack_allocator_base const &)       = delete;
           protected:
-            constexpr allocation_result * get_allocation() const noexcept { return {_data, N}; }
+            constexpr allocation_result get_allocation() const noexcept { return {const_cast<char *>(_data), N}; }
           private:
             alignas(StartAlignment) char _data[N];
         };
@@ -0,0 +1,99 @@
+#ifndef GSTD_ALLOCATION_STD_ADAPTER_HPP
+#define GSTD_ALLOCATION_STD_ADAPTER_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include "allocation/base.hpp"
+
+namespace gstd::allocation {
+    // meets the standard library's Allocator requirements (eg. `std::vector<T, std_adapter<T, Alloc>>`)
+    // stateless allocators are held by value, any other `Alloc` is referred to and has to outlive every copy
+    template<typename T, allocator Alloc>
+    class std_adapter {
+        static constexpr bool stateless = stateless_allocator<Alloc>;
+        // requests are rounded up so bump allocators stay aligned for the next one
+        static constexpr size_t alignment = alignof(std::max_align_t);
+        static_assert(alignof(T) <= alignment, "over-aligned types aren't supported");
+
+        template<typename, allocator>
+        friend class std_adapter;
+      public:
+        using value_type                             = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap            = std::true_type;
+        using is_always_equal                        = std::bool_constant<stateless>;
+
+        template<typename U>
+        struct rebind {
+            using other = std_adapter<U, Alloc>;
+        };
+
+        constexpr std_adapter() noexcept
+        requires stateless
+        = default;
+
+        constexpr std_adapter(Alloc & alloc) noexcept
+        requires (!stateless)
+            : _alloc{std::addressof(alloc)}
+        {}
+
+        constexpr std_adapter(Alloc const & alloc) noexcept
+        requires stateless
+            : _alloc{alloc}
+        {}
+
+        template<typename U>
+        constexpr std_adapter(std_adapter<U, Alloc> const & other) noexcept : _alloc{other._alloc}
+        {}
+
+        // the size `Alloc` returned is kept in a header in front of the elements, so it gets the same size back
+        [[nodiscard]] T * allocate(size_t n)
+        {
+            if(n > (std::numeric_limits<size_t>::max() - 2 * alignment) / sizeof(T))
+                throw std::bad_array_new_length{};
+            auto allocation = get().allocate(bytes(n) + alignment);
+            if(!allocation)
+                throw std::bad_alloc{};
+            auto * header = static_cast<char *>(allocation.ptr);
+            ::new(header) size_t{allocation.size};
+            return reinterpret_cast<T *>(header + alignment);
+        }
+
+        void deallocate(T * ptr, size_t) noexcept
+        {
+            auto * header = reinterpret_cast<char *>(ptr) - alignment;
+            get().deallocate({header, *std::launder(reinterpret_cast<size_t *>(header))});
+        }
+
+        // the underlying allocator
+        [[nodiscard]] constexpr Alloc & get() noexcept
+        {
+            if constexpr(stateless)
+                return _alloc;
+            else
+                return *_alloc;
+        }
+
+        template<typename U>
+        [[nodiscard]] constexpr bool operator==(std_adapter<U, Alloc> const & rhs) const noexcept
+        {
+            if constexpr(stateless)
+                return true;
+            else
+                return _alloc == rhs._alloc;
+        }
+      private:
+        [[nodiscard]] static constexpr size_t bytes(size_t n) noexcept
+        {
+            return (n * sizeof(T) + alignment - 1) / alignment * alignment;
+        }
+
+        [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc;
+    };
+}
+
+#endif
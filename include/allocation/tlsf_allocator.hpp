@@ -0,0 +1,282 @@
+#ifndef GSTD_ALLOCATION_TLSF_ALLOCATOR_HPP
+#define GSTD_ALLOCATION_TLSF_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "allocation/arena_allocator.hpp"
+#include "allocation/base.hpp"
+
+// Two-Level Segregated Fit (Masmano, Ripoll, Crespo & Real, ECRTS 2004) over a single pool from `Parent`: free blocks
+// are kept in lists by size, first by power of two, then linearly within it in 32 steps (16 bytes apart below
+// 512 bytes). A bitmap per level makes finding a list with large enough blocks two `countr_zero`s, so `allocate`,
+// `deallocate` and `reallocate` (short of copying) run in constant time.
+// Blocks are split on allocation and coalesced with their free neighbours as soon as they're freed, every block
+// starts with a 16 byte header (the previous block in memory and the size), payloads are 16 byte aligned.
+
+namespace gstd::allocation {
+    template<allocator Parent>
+    class tlsf_allocator {
+        static constexpr size_t align_shift = 4;
+        static constexpr size_t alignment   = size_t{1} << align_shift;
+        static constexpr size_t sl_shift    = 5;
+        static constexpr size_t sl_count    = size_t{1} << sl_shift;
+        // every size below `size_t{1} << fl_shift` is in the first list
+        static constexpr size_t fl_shift = sl_shift + align_shift;
+        static constexpr size_t fl_count = 32;
+        static constexpr size_t max_size = (size_t{1} << (fl_shift + fl_count - 1)) - alignment;
+
+        struct block {
+            static constexpr size_t free_bit = 1;
+
+            [[nodiscard]] size_t size() const noexcept { return header & ~(alignment - 1); }
+
+            [[nodiscard]] bool free() const noexcept { return header & free_bit; }
+
+            [[nodiscard]] void * payload() noexcept { return reinterpret_cast<char *>(this) + sizeof(block); }
+
+            [[nodiscard]] block * next_phys() noexcept
+            {
+                return reinterpret_cast<block *>(static_cast<char *>(payload()) + size());
+            }
+
+            [[nodiscard]] static block * from_payload(void * ptr) noexcept
+            {
+                return reinterpret_cast<block *>(static_cast<char *>(ptr) - sizeof(block));
+            }
+
+            block * prev_phys;
+            size_t header;
+        };
+
+        static_assert(sizeof(block) == alignment);
+
+        // links in the payload of free blocks
+        struct links {
+            block * next;
+            block * prev;
+        };
+
+        // blocks are only split if the rest can hold the links
+        static constexpr size_t min_payload = sizeof(links);
+
+        struct index {
+            size_t fl;
+            size_t sl;
+        };
+      public:
+        // the pool is `size` bytes (less two block headers) from `Parent{args...}`
+        template<typename... Args>
+        explicit(sizeof...(Args) == 0) tlsf_allocator(arena_size size, Args &&... args) noexcept(
+          std::is_nothrow_constructible_v<Parent, Args...>
+        )
+            : _parent(static_cast<Args &&>(args)...)
+        {
+            auto bytes = std::min(static_cast<size_t>(size), max_size + 2 * sizeof(block)) & ~(alignment - 1);
+            if(bytes < 2 * sizeof(block) + min_payload)
+                return;
+            _pool = _parent.allocate(bytes);
+            if(!_pool)
+                return;
+            auto * first     = static_cast<block *>(_pool.ptr);
+            first->prev_phys = nullptr;
+            first->header    = bytes - 2 * sizeof(block);
+            // never free, so nothing is coalesced past the end of the pool
+            auto * sentinel     = first->next_phys();
+            sentinel->prev_phys = first;
+            sentinel->header    = 0;
+            release(first);
+        }
+
+        tlsf_allocator(tlsf_allocator && other) noexcept(std::is_nothrow_move_constructible_v<Parent>)
+            : _parent(std::move(other._parent)), _pool{std::exchange(other._pool, no_allocation)}
+            , _fl_bitmap{std::exchange(other._fl_bitmap, 0)}
+        {
+            std::memcpy(_sl_bitmaps, other._sl_bitmaps, sizeof(_sl_bitmaps));
+            std::memcpy(_heads, other._heads, sizeof(_heads));
+            // `find` looks at the second-level bitmaps without the first-level one, `other` has to be empty
+            std::memset(other._sl_bitmaps, 0, sizeof(other._sl_bitmaps));
+            std::memset(other._heads, 0, sizeof(other._heads));
+        }
+
+        tlsf_allocator(tlsf_allocator const &) = delete;
+        void operator=(tlsf_allocator const &) = delete;
+
+        ~tlsf_allocator()
+        {
+            if(_pool)
+                _parent.deallocate(_pool);
+        }
+
+        // the size is the usable size of the block, a multiple of 16 bytes
+        [[nodiscard]] allocation_result allocate(size_t size) noexcept
+        {
+            if(size > max_size)
+                return no_allocation;
+            size     = adjust(size);
+            auto i   = search(size);
+            auto * b = find(i);
+            // the list `size` itself belongs in may still have a large enough block at its head
+            if(!b) {
+                i = map(size);
+                b = _heads[i.fl][i.sl];
+                if(!b || b->size() < size)
+                    return no_allocation;
+            }
+            remove(b, i);
+            b->header = b->size();
+            split(b, size);
+            return {b->payload(), b->size()};
+        }
+
+        void deallocate(allocation_result allocation) noexcept
+        {
+            if(allocation.ptr)
+                release(block::from_payload(allocation.ptr));
+        }
+
+        // grows into a free successor (or shrinks) in place if possible, moves the contents otherwise
+        // fails without touching `allocation` if there's no room
+        [[nodiscard]] allocation_result reallocate(allocation_result allocation, size_t new_size) noexcept
+        {
+            if(!allocation.ptr)
+                return allocate(new_size);
+            if(new_size > max_size)
+                return no_allocation;
+            auto * b    = block::from_payload(allocation.ptr);
+            auto size   = adjust(new_size);
+            auto * next = b->next_phys();
+            if(size > b->size() && next->free() && b->size() + sizeof(block) + next->size() >= size) {
+                remove(next, map(next->size()));
+                b->header = b->size() + sizeof(block) + next->size();
+                b->next_phys()->prev_phys = b;
+            }
+            if(size <= b->size()) {
+                split(b, size);
+                return {b->payload(), b->size()};
+            }
+            auto moved = allocate(new_size);
+            if(!moved)
+                return no_allocation;
+            std::memcpy(moved.ptr, allocation.ptr, b->size());
+            release(b);
+            return moved;
+        }
+
+        [[nodiscard]] bool owns(allocation_result allocation) const noexcept
+        {
+            auto * ptr   = static_cast<char const *>(allocation.ptr);
+            auto * begin = static_cast<char const *>(_pool.ptr);
+            return begin && begin <= ptr && ptr < begin + _pool.size;
+        }
+      private:
+        [[nodiscard]] static size_t adjust(size_t size) noexcept
+        {
+            return std::max((size + alignment - 1) & ~(alignment - 1), min_payload);
+        }
+
+        // the list `size` belongs in
+        [[nodiscard]] static index map(size_t size) noexcept
+        {
+            if(size < (size_t{1} << fl_shift))
+                return {0, size >> align_shift};
+            auto log = static_cast<size_t>(std::bit_width(size)) - 1;
+            return {log - fl_shift + 1, (size >> (log - sl_shift)) ^ sl_count};
+        }
+
+        // the first list whose blocks are all at least `size`
+        [[nodiscard]] static index search(size_t size) noexcept
+        {
+            if(size >= (size_t{1} << fl_shift))
+                size += (size_t{1} << (static_cast<size_t>(std::bit_width(size)) - 1 - sl_shift)) - 1;
+            return map(size);
+        }
+
+        // the head of the first non-empty list from `i` on, updates `i`
+        [[nodiscard]] block * find(index & i) const noexcept
+        {
+            if(i.fl >= fl_count)
+                return nullptr;
+            auto sl_map = _sl_bitmaps[i.fl] & (~std::uint32_t{0} << i.sl);
+            if(!sl_map) {
+                auto fl_map = i.fl + 1 < fl_count ? _fl_bitmap & (~std::uint32_t{0} << (i.fl + 1)) : 0;
+                if(!fl_map)
+                    return nullptr;
+                i.fl   = static_cast<size_t>(std::countr_zero(fl_map));
+                sl_map = _sl_bitmaps[i.fl];
+            }
+            i.sl = static_cast<size_t>(std::countr_zero(sl_map));
+            return _heads[i.fl][i.sl];
+        }
+
+        [[nodiscard]] static links & links_of(block * b) noexcept { return *static_cast<links *>(b->payload()); }
+
+        void insert(block * b) noexcept
+        {
+            auto [fl, sl] = map(b->size());
+            auto & head   = _heads[fl][sl];
+            links_of(b)   = {head, nullptr};
+            if(head)
+                links_of(head).prev = b;
+            head = b;
+            _fl_bitmap |= std::uint32_t{1} << fl;
+            _sl_bitmaps[fl] |= std::uint32_t{1} << sl;
+        }
+
+        void remove(block * b, index i) noexcept
+        {
+            auto [next, prev] = links_of(b);
+            if(next)
+                links_of(next).prev = prev;
+            if(prev) {
+                links_of(prev).next = next;
+            } else if(!(_heads[i.fl][i.sl] = next)) {
+                _sl_bitmaps[i.fl] &= ~(std::uint32_t{1} << i.sl);
+                if(!_sl_bitmaps[i.fl])
+                    _fl_bitmap &= ~(std::uint32_t{1} << i.fl);
+            }
+        }
+
+        // gives the end of the used block `b` beyond `size` back if it's large enough for a block of its own
+        void split(block * b, size_t size) noexcept
+        {
+            if(b->size() < size + sizeof(block) + min_payload)
+                return;
+            auto * rest     = reinterpret_cast<block *>(static_cast<char *>(b->payload()) + size);
+            rest->prev_phys = b;
+            rest->header    = b->size() - size - sizeof(block);
+            b->header       = size;
+            rest->next_phys()->prev_phys = rest;
+            release(rest);
+        }
+
+        // frees the used block `b`, merging it with its free neighbours
+        void release(block * b) noexcept
+        {
+            if(auto * prev = b->prev_phys; prev && prev->free()) {
+                remove(prev, map(prev->size()));
+                prev->header = prev->size() + sizeof(block) + b->size();
+                b            = prev;
+            }
+            if(auto * next = b->next_phys(); next->free()) {
+                remove(next, map(next->size()));
+                b->header = b->size() + sizeof(block) + next->size();
+            }
+            b->header |= block::free_bit;
+            b->next_phys()->prev_phys = b;
+            insert(b);
+        }
+
+        [[no_unique_address]] Parent _parent;
+        allocation_result _pool  = no_allocation;
+        std::uint32_t _fl_bitmap = 0;
+        std::uint32_t _sl_bitmaps[fl_count]{};
+        block * _heads[fl_count][sl_count]{};
+    };
+}
+
+#endif
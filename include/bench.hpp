@@ -0,0 +1,6 @@
+#ifndef GSTD_BENCH_HPP
+#define GSTD_BENCH_HPP
+
+#include "bench/harness.hpp"
+
+#endif
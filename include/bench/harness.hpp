@@ -0,0 +1,174 @@
+#ifndef GSTD_BENCH_HARNESS_HPP
+#define GSTD_BENCH_HARNESS_HPP
+
+#include <chrono>
+#include <concepts>
+#include <functional>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include "time/tsc_clock.hpp"
+
+// Micro-benchmark harness: every benchmark is warmed up, its iterations per sample are doubled until a sample takes
+// long enough to be timed reliably, then the samples (nanoseconds per iteration) are summarized by their median,
+// median absolute deviation and a distribution-free confidence interval of the median (see src/bench.cpp).
+// `runner{argc, argv}` understands
+//   --format=table|csv|json  table (default) is printed as benchmarks finish, the others by `finish()`
+//   --baseline=<file>        compares against the medians of an earlier `--format=csv` run
+//   --filter=<substring>     only runs benchmarks whose name contains it
+//   --samples=<n>            samples per benchmark (30 by default)
+
+namespace gstd::bench {
+    using size_t = decltype(sizeof(nullptr));
+
+    // makes the compiler assume `value` is read (and may be written), so computing it can't be optimized away
+    template<typename T>
+    inline void do_not_optimize(T & value) noexcept
+    {
+        if constexpr(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(void *))
+            asm volatile("" : "+m,r"(value) : : "memory");
+        else
+            asm volatile("" : "+m"(value) : : "memory");
+    }
+
+    template<typename T>
+    inline void do_not_optimize(T const & value) noexcept
+    {
+        asm volatile("" : : "m"(value) : "memory");
+    }
+
+    // makes the compiler assume all memory is read and written, so stores before it can't be optimized away
+    inline void clobber_memory() noexcept { asm volatile("" : : : "memory"); }
+
+    struct options {
+        // time spent running a benchmark before sampling it
+        std::chrono::nanoseconds warmup{std::chrono::milliseconds{100}};
+        // iterations per sample are doubled until a sample takes at least this long
+        std::chrono::nanoseconds min_sample{std::chrono::milliseconds{5}};
+        size_t samples = 30;
+        // of the median's confidence interval
+        double confidence = 0.95;
+    };
+
+    enum class format {
+        table,
+        csv,
+        json,
+    };
+
+    // all times in nanoseconds per iteration
+    struct result {
+        std::string name;
+        size_t iterations; // per sample
+        size_t samples;
+        double median;
+        double mad; // median absolute deviation
+        double ci_low;
+        double ci_high;
+        double min;
+        double max;
+        // median relative to the baseline's (eg. 1.1 is 10% slower), `std::nullopt` without one
+        std::optional<double> ratio;
+        // the confidence intervals don't overlap
+        bool significant = false;
+    };
+
+    // summarizes samples of nanoseconds per iteration
+    [[nodiscard]] result analyze(std::string name, size_t iterations, std::vector<double> samples, double confidence);
+
+    class runner {
+        using clock = time::tsc_clock;
+      public:
+        explicit runner(options opts = {});
+        // throws `std::invalid_argument` for unknown arguments, `std::runtime_error` if the baseline can't be read
+        runner(int argc, char const * const * argv, options opts = {});
+
+        // times `fn()`
+        template<typename F>
+        requires std::invocable<F &>
+        void run(std::string_view name, F && fn)
+        {
+            if(!selected(name))
+                return;
+            measure(name, [&](size_t iterations) {
+                auto start = clock::now();
+                for(size_t i = 0; i < iterations; ++i)
+                    invoke(fn);
+                return clock::now() - start;
+            });
+        }
+
+        // times `fn(input)` with a fresh `input = setup()` for every iteration, which isn't timed
+        template<typename Setup, typename F>
+        requires std::invocable<F &, std::invoke_result_t<Setup &> &>
+        void run(std::string_view name, Setup && setup, F && fn)
+        {
+            if(!selected(name))
+                return;
+            measure(name, [&](size_t iterations) {
+                clock::duration total{};
+                for(size_t i = 0; i < iterations; ++i) {
+                    auto input = setup();
+                    clobber_memory();
+                    auto start = clock::now();
+                    invoke(fn, input);
+                    total += clock::now() - start;
+                }
+                return total;
+            });
+        }
+
+        [[nodiscard]] std::vector<result> const & results() const noexcept { return _results; }
+
+        // prints CSV/JSON output, returns the exit code for `main`
+        int finish();
+      private:
+        template<typename F, typename... Args>
+        static void invoke(F & fn, Args &... args)
+        {
+            if constexpr(std::is_void_v<std::invoke_result_t<F &, Args &...>>) {
+                std::invoke(fn, args...);
+            } else {
+                auto value = std::invoke(fn, args...);
+                do_not_optimize(value);
+            }
+        }
+
+        // `batch(n)` runs `n` iterations and returns the time they took
+        template<typename Batch>
+        void measure(std::string_view name, Batch && batch)
+        {
+            size_t iterations = 1;
+            auto warm         = clock::now() + _options.warmup;
+            for(;;) {
+                auto elapsed = batch(iterations);
+                if(elapsed < _options.min_sample)
+                    iterations *= 2;
+                else if(clock::now() >= warm)
+                    break;
+            }
+            std::vector<double> samples(_options.samples);
+            for(auto & sample : samples) {
+                std::chrono::duration<double, std::nano> elapsed = batch(iterations);
+                sample = elapsed.count() / static_cast<double>(iterations);
+            }
+            record(analyze(std::string{name}, iterations, std::move(samples), _options.confidence));
+        }
+
+        [[nodiscard]] bool selected(std::string_view name) const noexcept;
+        // compares against the baseline and prints tables
+        void record(result r);
+
+        options _options;
+        format _format = format::table;
+        std::string _filter;
+        // baseline medians and confidence intervals by name
+        std::map<std::string, result, std::less<>> _baseline;
+        std::vector<result> _results;
+    };
+}
+
+#endif
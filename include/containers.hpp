@@ -0,0 +1,6 @@
+#ifndef GSTD_CONTAINERS_HPP
+#define GSTD_CONTAINERS_HPP
+
+#include "containers/flat_map.hpp"
+
+#endif
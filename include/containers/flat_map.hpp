@@ -0,0 +1,459 @@
+#ifndef GSTD_CONTAINERS_FLAT_MAP_HPP
+#define GSTD_CONTAINERS_FLAT_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+#include "allocation/std_adapter.hpp"
+#include "ranges/concepts.hpp"
+#include "ranges/to.hpp"
+
+// Immutable sorted associative containers for tables that are built once and queried a lot. Keys are stored in
+// Eytzinger (breadth-first) order: the root at index 1, the children of `k` at `2k` and `2k + 1`. A lookup walks down
+// with a branchless `k = 2k + (key[k] < x)` and prefetches the cache line holding the node's descendants a few levels
+// further down (four for 4-byte keys), so it's bound by memory latency rather than by mispredicted branches.
+// Iteration is in key order. Keys and values (in separate arrays) come from `Alloc`, keys are cache-line aligned.
+// If the input contains a key multiple times, its first occurrence is kept (like `std::map::insert`).
+
+namespace gstd::containers {
+    using size_t = decltype(sizeof(nullptr));
+
+    namespace _impl::flat {
+        inline constexpr size_t cache_line = 64;
+
+        inline void prefetch([[maybe_unused]] void const * ptr) noexcept
+        {
+#if defined(__GNUC__)
+            __builtin_prefetch(ptr);
+#endif
+        }
+
+        // leftmost of `n` nodes, 0 if there are none
+        [[nodiscard]] constexpr size_t first(size_t n) noexcept { return n ? std::bit_floor(n) : 0; }
+
+        // in-order successor of node `k` out of `n`, 0 after the last one
+        [[nodiscard]] constexpr size_t next(size_t k, size_t n) noexcept
+        {
+            if(2 * k + 1 > n)
+                return k >> (std::countr_one(k) + 1); // up past every ancestor `k` is a right descendant of
+            k = 2 * k + 1;
+            while(2 * k <= n)
+                k *= 2;
+            return k;
+        }
+
+        // uninitialized, cache-line aligned array with indices [1, size], has to be `release`d
+        template<typename T>
+        class storage {
+            static_assert(alignof(T) <= cache_line);
+          public:
+            storage() = default;
+
+            storage(allocation::allocator auto & alloc, size_t size)
+            {
+                if(size >= std::numeric_limits<size_t>::max() / sizeof(T) - 2 * cache_line)
+                    throw std::bad_array_new_length{};
+                constexpr size_t alignment = alignof(std::max_align_t);
+                auto bytes                 = (size + 1) * sizeof(T) + cache_line - alignment;
+                _allocation                = alloc.allocate((bytes + alignment - 1) / alignment * alignment);
+                if(!_allocation)
+                    throw std::bad_alloc{};
+                auto address = reinterpret_cast<std::uintptr_t>(_allocation.ptr);
+                _data        = reinterpret_cast<T *>((address + cache_line - 1) & ~(cache_line - 1));
+            }
+
+            storage(storage && other) noexcept
+                : _allocation{std::exchange(other._allocation, allocation::no_allocation)}
+                , _data{std::exchange(other._data, nullptr)}
+            {}
+
+            storage & operator=(storage && rhs) noexcept
+            {
+                std::swap(_allocation, rhs._allocation);
+                std::swap(_data, rhs._data);
+                return *this;
+            }
+
+            void release(allocation::allocator auto & alloc) noexcept
+            {
+                if(_allocation)
+                    alloc.deallocate(std::exchange(_allocation, allocation::no_allocation));
+                _data = nullptr;
+            }
+
+            [[nodiscard]] T * data() const noexcept { return _data; }
+
+            [[nodiscard]] T & operator[](size_t k) const noexcept { return _data[k]; }
+          private:
+            allocation::allocation_result _allocation = allocation::no_allocation;
+            T * _data                                 = nullptr;
+        };
+
+        template<typename Key, typename T>
+        struct entry {
+            using type = std::pair<Key, T>;
+        };
+
+        template<typename Key>
+        struct entry<Key, void> {
+            using type = Key;
+        };
+
+        // the common part of `flat_map` (`T` is the mapped type) and `flat_set` (`T` is `void`)
+        template<typename Key, typename T, typename Compare, allocation::allocator Alloc>
+        class table {
+            static constexpr bool is_map    = !std::is_void_v<T>;
+            static constexpr bool stateless = allocation::stateless_allocator<Alloc>;
+            // nodes per cache line, the descendants `log2(stride)` levels below node `k` start at node `k * stride`
+            static constexpr size_t stride = std::bit_floor(std::max<size_t>(cache_line / sizeof(Key), 1));
+
+            using mapped_type = std::conditional_t<is_map, T, char>;
+          public:
+            using key_type   = Key;
+            using value_type = entry<Key, T>::type;
+
+            template<bool Const>
+            class basic_iterator {
+                using owner = std::conditional_t<Const, table const, table>;
+              public:
+                using iterator_concept = std::forward_iterator_tag;
+                using difference_type  = std::ptrdiff_t;
+                // maps yield pairs of references, `std::pair<Key, T>` only has a common reference with those in C++23
+                using value_type = std::conditional_t<
+                  is_map,
+                  std::pair<Key const &, std::conditional_t<Const, mapped_type const &, mapped_type &>>,
+                  Key>;
+
+                basic_iterator() = default;
+
+                basic_iterator(owner * t, size_t k) noexcept : _table{t}, _k{k} {}
+
+                template<bool OtherConst>
+                requires (Const && !OtherConst)
+                basic_iterator(basic_iterator<OtherConst> other) noexcept : _table{other._table}, _k{other._k}
+                {}
+
+                [[nodiscard]] decltype(auto) operator*() const noexcept
+                {
+                    Key const & key = _table->_keys[_k];
+                    if constexpr(is_map)
+                        return value_type{key, _table->_values[_k]};
+                    else
+                        return key;
+                }
+
+                basic_iterator & operator++() noexcept
+                {
+                    _k = next(_k, _table->_size);
+                    return *this;
+                }
+
+                basic_iterator operator++(int) noexcept
+                {
+                    auto copy = *this;
+                    ++*this;
+                    return copy;
+                }
+
+                [[nodiscard]] friend bool operator==(basic_iterator const & lhs, basic_iterator const & rhs) noexcept
+                {
+                    return lhs._k == rhs._k;
+                }
+              private:
+                friend table;
+                friend basic_iterator<!Const>;
+
+                owner * _table = nullptr;
+                size_t _k      = 0;
+            };
+
+            // keys are never mutable, values of a `flat_map` are
+            using iterator       = basic_iterator<!is_map>;
+            using const_iterator = basic_iterator<true>;
+
+            table() = default;
+
+            template<ranges::input_range R>
+            table(R && rng, Alloc & alloc, Compare comp) : _alloc{held(alloc)}, _comp(std::move(comp))
+            {
+                // collected, sorted and deduplicated in a temporary vector using the same allocator
+                using temporary = std::vector<value_type, allocation::std_adapter<value_type, Alloc>>;
+                auto sorted     = ranges::to<temporary>(static_cast<R &&>(rng), alloc);
+                auto less       = [this](value_type const & a, value_type const & b) {
+                    return std::invoke(_comp, key_of(a), key_of(b));
+                };
+                std::stable_sort(sorted.begin(), sorted.end(), less);
+                auto last = std::unique(sorted.begin(), sorted.end(), [&](auto & a, auto & b) { return !less(a, b); });
+                auto size = static_cast<size_t>(last - sorted.begin());
+                if(!size)
+                    return;
+                _keys = storage<Key>{alloc, size};
+                try {
+                    if constexpr(is_map)
+                        _values = storage<mapped_type>{alloc, size};
+                    // an in-order walk visits the sorted entries in order
+                    auto it = sorted.begin();
+                    for(auto k = first(size); k; k = next(k, size), ++it, ++_size) {
+                        if constexpr(is_map) {
+                            ::new(_keys.data() + k) Key(std::move(it->first));
+                            try {
+                                ::new(_values.data() + k) T(std::move(it->second));
+                            } catch(...) {
+                                _keys[k].~Key();
+                                throw;
+                            }
+                        } else {
+                            ::new(_keys.data() + k) Key(std::move(*it));
+                        }
+                    }
+                } catch(...) {
+                    // `_size` nodes were constructed in order, the tree's shape depends on the full size though
+                    for(auto k = first(size); _size; k = next(k, size), --_size)
+                        destroy(k);
+                    release();
+                    throw;
+                }
+            }
+
+            table(table && other) noexcept
+                : _alloc(other._alloc), _comp(std::move(other._comp)), _keys{std::move(other._keys)}
+                , _values{std::move(other._values)}, _size{std::exchange(other._size, 0)}
+            {}
+
+            table & operator=(table && rhs) noexcept
+            {
+                std::swap(_alloc, rhs._alloc);
+                std::swap(_comp, rhs._comp);
+                std::swap(_keys, rhs._keys);
+                std::swap(_values, rhs._values);
+                std::swap(_size, rhs._size);
+                return *this;
+            }
+
+            ~table()
+            {
+                for(size_t k = 1; k <= _size; ++k)
+                    destroy(k);
+                release();
+            }
+
+            [[nodiscard]] size_t size() const noexcept { return _size; }
+
+            [[nodiscard]] bool empty() const noexcept { return !_size; }
+
+            [[nodiscard]] iterator begin() noexcept { return {this, first(_size)}; }
+
+            [[nodiscard]] const_iterator begin() const noexcept { return {this, first(_size)}; }
+
+            [[nodiscard]] iterator end() noexcept { return {this, 0}; }
+
+            [[nodiscard]] const_iterator end() const noexcept { return {this, 0}; }
+
+            // first element whose key isn't less than `key`
+            template<typename K>
+            requires std::predicate<Compare const &, Key const &, K const &>
+            [[nodiscard]] iterator lower_bound(K const & key) noexcept
+            {
+                return {this, lower_bound_index(key)};
+            }
+
+            template<typename K>
+            requires std::predicate<Compare const &, Key const &, K const &>
+            [[nodiscard]] const_iterator lower_bound(K const & key) const noexcept
+            {
+                return {this, lower_bound_index(key)};
+            }
+
+            template<typename K>
+            requires std::predicate<Compare const &, Key const &, K const &>
+                     && std::predicate<Compare const &, K const &, Key const &>
+            [[nodiscard]] iterator find(K const & key) noexcept
+            {
+                return {this, find_index(key)};
+            }
+
+            template<typename K>
+            requires std::predicate<Compare const &, Key const &, K const &>
+                     && std::predicate<Compare const &, K const &, Key const &>
+            [[nodiscard]] const_iterator find(K const & key) const noexcept
+            {
+                return {this, find_index(key)};
+            }
+
+            template<typename K>
+            requires std::predicate<Compare const &, Key const &, K const &>
+                     && std::predicate<Compare const &, K const &, Key const &>
+            [[nodiscard]] bool contains(K const & key) const noexcept
+            {
+                return find_index(key);
+            }
+          protected:
+            template<typename K>
+            [[nodiscard]] size_t find_index(K const & key) const noexcept
+            {
+                auto k = lower_bound_index(key);
+                return k && !std::invoke(_comp, key, _keys[k]) ? k : 0;
+            }
+
+            template<typename K>
+            [[nodiscard]] size_t lower_bound_index(K const & key) const noexcept
+            {
+                auto * keys = _keys.data();
+                size_t k    = 1;
+                while(k <= _size) {
+                    // only a hint, so it may point past the end
+                    prefetch(reinterpret_cast<void const *>(
+                      reinterpret_cast<std::uintptr_t>(keys) + k * stride * sizeof(Key)
+                    ));
+                    k = 2 * k + static_cast<size_t>(std::invoke(_comp, keys[k], key));
+                }
+                // below the answer the path went left once and then right at every level
+                return k >> (std::countr_one(k) + 1);
+            }
+
+            [[nodiscard]] mapped_type & mapped(size_t k) const noexcept { return _values[k]; }
+          private:
+            [[nodiscard]] static auto held(Alloc & alloc) noexcept
+            {
+                if constexpr(stateless)
+                    return alloc;
+                else
+                    return std::addressof(alloc);
+            }
+
+            [[nodiscard]] static Key const & key_of(value_type const & e) noexcept
+            {
+                if constexpr(is_map)
+                    return e.first;
+                else
+                    return e;
+            }
+
+            void destroy(size_t k) noexcept
+            {
+                _keys[k].~Key();
+                if constexpr(is_map)
+                    _values[k].~T();
+            }
+
+            void release() noexcept
+            {
+                _size = 0;
+                if(!_keys.data())
+                    return;
+                auto & alloc = [this]() -> Alloc & {
+                    if constexpr(stateless)
+                        return _alloc;
+                    else
+                        return *_alloc;
+                }();
+                _keys.release(alloc);
+                _values.release(alloc);
+            }
+
+            [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc{};
+            [[no_unique_address]] Compare _comp{};
+            storage<Key> _keys;
+            storage<mapped_type> _values;
+            size_t _size = 0;
+        };
+    }
+
+    // `Alloc` has to outlive the container unless it's stateless
+    template<
+      typename Key,
+      typename T,
+      typename Compare            = std::ranges::less,
+      allocation::allocator Alloc = allocation::c_allocator_type>
+    class flat_map : public _impl::flat::table<Key, T, Compare, Alloc> {
+        using base = _impl::flat::table<Key, T, Compare, Alloc>;
+      public:
+        using mapped_type = T;
+
+        flat_map() = default;
+
+        template<ranges::input_range R>
+        explicit flat_map(R && rng, Compare comp = {})
+        requires allocation::stateless_allocator<Alloc>
+            : flat_map(static_cast<R &&>(rng), Alloc{}, std::move(comp))
+        {}
+
+        template<ranges::input_range R>
+        flat_map(R && rng, Alloc & alloc, Compare comp = {})
+        requires (!allocation::stateless_allocator<Alloc>)
+            : base(static_cast<R &&>(rng), alloc, std::move(comp))
+        {}
+
+        // stateless allocators are copied, so `allocation::c_allocator` (or any other `const` one) can be passed
+        template<ranges::input_range R>
+        flat_map(R && rng, Alloc alloc, Compare comp = {})
+        requires allocation::stateless_allocator<Alloc>
+            : base(static_cast<R &&>(rng), alloc, std::move(comp))
+        {}
+
+        // throws `std::out_of_range` if there's no such key
+        template<typename K>
+        [[nodiscard]] T & at(K const & key)
+        {
+            return this->mapped(checked(key));
+        }
+
+        template<typename K>
+        [[nodiscard]] T const & at(K const & key) const
+        {
+            return this->mapped(checked(key));
+        }
+      private:
+        template<typename K>
+        [[nodiscard]] size_t checked(K const & key) const
+        {
+            auto k = this->find_index(key);
+            if(!k)
+                throw std::out_of_range{"gstd::containers::flat_map::at"};
+            return k;
+        }
+    };
+
+    template<
+      typename Key,
+      typename Compare            = std::ranges::less,
+      allocation::allocator Alloc = allocation::c_allocator_type>
+    class flat_set : public _impl::flat::table<Key, void, Compare, Alloc> {
+        using base = _impl::flat::table<Key, void, Compare, Alloc>;
+      public:
+        flat_set() = default;
+
+        template<ranges::input_range R>
+        explicit flat_set(R && rng, Compare comp = {})
+        requires allocation::stateless_allocator<Alloc>
+            : flat_set(static_cast<R &&>(rng), Alloc{}, std::move(comp))
+        {}
+
+        template<ranges::input_range R>
+        flat_set(R && rng, Alloc & alloc, Compare comp = {})
+        requires (!allocation::stateless_allocator<Alloc>)
+            : base(static_cast<R &&>(rng), alloc, std::move(comp))
+        {}
+
+        template<ranges::input_range R>
+        flat_set(R && rng, Alloc alloc, Compare comp = {})
+        requires allocation::stateless_allocator<Alloc>
+            : base(static_cast<R &&>(rng), alloc, std::move(comp))
+        {}
+    };
+}
+
+#endif
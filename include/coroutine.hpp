@@ -0,0 +1,9 @@
+#ifndef GSTD_COROUTINE_HPP
+#define GSTD_COROUTINE_HPP
+
+#include "coroutine/generator.hpp"
+#include "coroutine/scheduler.hpp"
+#include "coroutine/task.hpp"
+#include "coroutine/when_all.hpp"
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef GSTD_COROUTINE_GENERATOR_HPP
+#define GSTD_COROUTINE_GENERATOR_HPP
+
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+
+// `generator<T>` is a lazily evaluated input range of `T &`: `co_yield` an rvalue to hand it out without copying
+// (lvalues are copied), or `co_yield elements_of(rng)` to yield every element of `rng` in turn.
+// Nested generators are resumed directly by the outermost one, so advancing costs the same at every depth.
+// Frames are allocated from `allocation::c_allocator` unless the coroutine takes `std::allocator_arg_t, Alloc &` as
+// its first parameters (after the object parameter for member functions), in which case `Alloc` is used (for the
+// frames `co_yield elements_of(rng)` wraps ranges other than generators in as well). Stateful allocators are referred
+// to, so they have to be taken by reference and outlive the generator.
+
+namespace gstd::coroutine {
+    template<typename R>
+    struct elements_of {
+        R range;
+    };
+
+    template<typename R>
+    elements_of(R &&) -> elements_of<R &&>;
+
+    namespace _impl::generator {
+        using allocation::size_t;
+
+        // placed behind the frame, knows how to give it back to the allocator it came from
+        struct frame_trailer {
+            void (*release)(void * alloc, allocation::allocation_result allocation) noexcept;
+            void * alloc;
+            allocation::allocation_result allocation;
+        };
+
+        inline constexpr size_t frame_alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+        [[nodiscard]] constexpr size_t round_up(size_t size, size_t alignment) noexcept
+        {
+            return (size + alignment - 1) / alignment * alignment;
+        }
+
+        [[nodiscard]] constexpr size_t trailer_offset(size_t size) noexcept
+        {
+            return round_up(size, alignof(frame_trailer));
+        }
+
+        template<allocation::allocator Alloc>
+        [[nodiscard]] allocation::allocation_result acquire(void * alloc, size_t size) noexcept
+        {
+            if constexpr(allocation::stateless_allocator<Alloc>)
+                return Alloc{}.allocate(size);
+            else
+                return static_cast<Alloc *>(alloc)->allocate(size);
+        }
+
+        template<allocation::allocator Alloc>
+        void release(void * alloc, allocation::allocation_result allocation) noexcept
+        {
+            if constexpr(allocation::stateless_allocator<Alloc>)
+                Alloc{}.deallocate(allocation);
+            else
+                static_cast<Alloc *>(alloc)->deallocate(allocation);
+        }
+
+        // the allocator a generator's frame came from, kept by its promise for the frames of wrapped ranges
+        class frame_allocator {
+          public:
+            template<allocation::allocator Alloc>
+            requires (!std::same_as<std::remove_const_t<Alloc>, frame_allocator>)
+            explicit frame_allocator(Alloc & alloc) noexcept
+                : _alloc{const_cast<std::remove_const_t<Alloc> *>(std::addressof(alloc))}
+                , _allocate{&acquire<std::remove_const_t<Alloc>>}, _deallocate{&release<std::remove_const_t<Alloc>>}
+            {}
+
+            [[nodiscard]] allocation::allocation_result allocate(size_t size) const noexcept
+            {
+                return _allocate(_alloc, size);
+            }
+
+            void deallocate(allocation::allocation_result allocation) const noexcept
+            {
+                _deallocate(_alloc, allocation);
+            }
+          private:
+            void * _alloc;
+            allocation::allocation_result (*_allocate)(void * alloc, size_t size) noexcept;
+            void (*_deallocate)(void * alloc, allocation::allocation_result allocation) noexcept;
+        };
+
+        template<allocation::allocator Alloc>
+        [[nodiscard]] void * allocate_frame(Alloc & alloc, size_t size)
+        {
+            // rounded up so bump allocators stay aligned for the next frame
+            auto allocation = alloc.allocate(round_up(trailer_offset(size) + sizeof(frame_trailer), frame_alignment));
+            if(!allocation)
+                throw std::bad_alloc{};
+            void * state = nullptr;
+            if constexpr(!allocation::stateless_allocator<std::remove_const_t<Alloc>>)
+                state = std::addressof(alloc);
+            auto * frame = static_cast<char *>(allocation.ptr);
+            ::new(frame + trailer_offset(size)) frame_trailer{&release<std::remove_const_t<Alloc>>, state, allocation};
+            return frame;
+        }
+
+        inline void deallocate_frame(void * frame, size_t size) noexcept
+        {
+            auto * trailer = static_cast<char *>(frame) + trailer_offset(size);
+            auto [release, alloc, allocation] = *std::launder(reinterpret_cast<frame_trailer *>(trailer));
+            release(alloc, allocation);
+        }
+
+        template<typename T, typename R>
+        auto elements(frame_allocator & alloc, R && rng);
+    }
+
+    template<typename T>
+    class [[nodiscard]] generator {
+        static_assert(std::is_object_v<T> && !std::is_const_v<T>);
+      public:
+        class promise_type;
+        using handle = std::coroutine_handle<promise_type>;
+
+        class promise_type {
+            friend class generator;
+
+            // runs the nested generator and makes it the one the outermost generator resumes
+            struct nested_awaiter {
+                [[nodiscard]] constexpr bool await_ready() const noexcept { return !nested._coro; }
+
+                std::coroutine_handle<> await_suspend(handle h) noexcept
+                {
+                    auto & outer       = h.promise();
+                    auto & inner       = nested._coro.promise();
+                    inner._root        = outer._root;
+                    inner._parent      = &outer;
+                    outer._root->_leaf = &inner;
+                    return nested._coro;
+                }
+
+                void await_resume()
+                {
+                    if(nested._coro && nested._coro.promise()._error)
+                        std::rethrow_exception(nested._coro.promise()._error);
+                }
+
+                generator nested;
+            };
+
+            struct copy_awaiter {
+                [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+                void await_suspend(handle h) noexcept { h.promise()._root->_value = std::addressof(value); }
+
+                constexpr void await_resume() const noexcept {}
+
+                T value;
+            };
+
+            struct final_awaiter {
+                [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+                // a finished nested generator continues its parent
+                std::coroutine_handle<> await_suspend(handle h) noexcept
+                {
+                    auto & self = h.promise();
+                    if(!self._parent)
+                        return std::noop_coroutine();
+                    self._root->_leaf = self._parent;
+                    return handle::from_promise(*self._parent);
+                }
+
+                constexpr void await_resume() const noexcept {}
+            };
+          public:
+            promise_type() noexcept : _frame_allocator{allocation::c_allocator} {}
+
+            template<allocation::allocator Alloc, typename... Args>
+            promise_type(std::allocator_arg_t, Alloc & alloc, Args &...) noexcept : _frame_allocator{alloc}
+            {}
+
+            template<typename This, allocation::allocator Alloc, typename... Args>
+            promise_type(This &, std::allocator_arg_t, Alloc & alloc, Args &...) noexcept : _frame_allocator{alloc}
+            {}
+
+            [[nodiscard]] generator get_return_object() noexcept { return generator{handle::from_promise(*this)}; }
+
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            [[nodiscard]] final_awaiter final_suspend() const noexcept { return {}; }
+
+            std::suspend_always yield_value(T && value) noexcept
+            {
+                _root->_value = std::addressof(value);
+                return {};
+            }
+
+            copy_awaiter yield_value(T const & value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+            {
+                return {value};
+            }
+
+            nested_awaiter yield_value(elements_of<generator &&> nested) noexcept
+            {
+                return {std::move(nested.range)};
+            }
+
+            template<typename R>
+            nested_awaiter yield_value(elements_of<R> rng)
+            {
+                return {_impl::generator::elements<T>(_frame_allocator, static_cast<R>(rng.range))};
+            }
+
+            void await_transform() = delete;
+
+            void return_void() const noexcept {}
+
+            // the outermost generator propagates exceptions to whoever advanced it, nested ones to their parent
+            void unhandled_exception()
+            {
+                if(!_parent)
+                    throw;
+                _error = std::current_exception();
+            }
+
+            [[nodiscard]] static void * operator new(allocation::size_t size)
+            {
+                return _impl::generator::allocate_frame(allocation::c_allocator, size);
+            }
+
+            template<allocation::allocator Alloc, typename... Args>
+            [[nodiscard]] static void *
+            operator new(allocation::size_t size, std::allocator_arg_t, Alloc & alloc, Args &...)
+            {
+                return _impl::generator::allocate_frame(alloc, size);
+            }
+
+            template<typename This, allocation::allocator Alloc, typename... Args>
+            [[nodiscard]] static void *
+            operator new(allocation::size_t size, This &, std::allocator_arg_t, Alloc & alloc, Args &...)
+            {
+                return _impl::generator::allocate_frame(alloc, size);
+            }
+
+            static void operator delete(void * frame, allocation::size_t size) noexcept
+            {
+                _impl::generator::deallocate_frame(frame, size);
+            }
+          private:
+            // the outermost generator's promise is the only one whose `_value` and `_leaf` are used
+            T * _value             = nullptr;
+            promise_type * _root   = this;
+            promise_type * _leaf   = this;
+            promise_type * _parent = nullptr;
+            std::exception_ptr _error;
+            _impl::generator::frame_allocator _frame_allocator;
+        };
+
+        class iterator {
+          public:
+            using value_type      = T;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            explicit iterator(handle coro) noexcept : _coro{coro} {}
+
+            [[nodiscard]] T & operator*() const noexcept { return *_coro.promise()._value; }
+
+            iterator & operator++()
+            {
+                handle::from_promise(*_coro.promise()._leaf).resume();
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            [[nodiscard]] friend bool operator==(iterator const & it, std::default_sentinel_t) noexcept
+            {
+                return it._coro.done();
+            }
+          private:
+            handle _coro;
+        };
+
+        generator() noexcept = default;
+
+        generator(generator && other) noexcept : _coro{std::exchange(other._coro, nullptr)} {}
+
+        generator & operator=(generator && rhs) noexcept
+        {
+            std::swap(_coro, rhs._coro);
+            return *this;
+        }
+
+        ~generator()
+        {
+            if(_coro)
+                _coro.destroy();
+        }
+
+        // runs to the first `co_yield`, mustn't be called more than once
+        [[nodiscard]] iterator begin()
+        {
+            _coro.resume();
+            return iterator{_coro};
+        }
+
+        [[nodiscard]] std::default_sentinel_t end() const noexcept { return {}; }
+      private:
+        explicit generator(handle coro) noexcept : _coro{coro} {}
+
+        handle _coro;
+    };
+
+    namespace _impl::generator {
+        template<typename T, typename R>
+        coroutine::generator<T> elements_of_range(std::allocator_arg_t, frame_allocator &, R rng)
+        {
+            for(auto && value : rng)
+                co_yield static_cast<T>(value);
+        }
+
+        // any range (including lvalue generators) is wrapped in a generator of its own, allocated like the yielding one
+        template<typename T, typename R>
+        auto elements(frame_allocator & alloc, R && rng)
+        {
+            return elements_of_range<T, R &&>(std::allocator_arg, alloc, static_cast<R &&>(rng));
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef GSTD_COROUTINE_SCHEDULER_HPP
+#define GSTD_COROUTINE_SCHEDULER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "coroutine/task.hpp"
+
+// Multi-threaded executor for `task`s: every worker owns a Chase-Lev deque of coroutines ready to be resumed and steals
+// from the others once it runs dry. Coroutines made ready elsewhere (other threads, the reactor) are injected in
+// batches under a single lock, waking at most as many sleeping workers as there are coroutines.
+// A reactor thread waits on file descriptors (epoll) and timers (a timerfd) for all workers (see src/scheduler.cpp).
+
+namespace gstd::coroutine {
+    namespace _impl::scheduler {
+        // fire-and-forget coroutine, starts eagerly and frees itself once it's done
+        struct detached {
+            struct promise_type : task::frame_allocated {
+                [[nodiscard]] constexpr detached get_return_object() const noexcept { return {}; }
+
+                [[nodiscard]] std::suspend_never initial_suspend() const noexcept { return {}; }
+
+                [[nodiscard]] std::suspend_never final_suspend() const noexcept { return {}; }
+
+                constexpr void return_void() const noexcept {}
+
+                [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+            };
+        };
+
+        template<typename T>
+        class blocker {
+          public:
+            void set_value(auto &&... value)
+            {
+                _value.emplace(static_cast<decltype(value) &&>(value)...);
+            }
+
+            void set_error(std::exception_ptr error) noexcept { _error = std::move(error); }
+
+            // last access by the finishing coroutine, `get` may return (and destroy `*this`) right after
+            void notify() noexcept
+            {
+                std::lock_guard lock{_mutex};
+                _done = true;
+                _finished.notify_one();
+            }
+
+            [[nodiscard]] T get()
+            {
+                std::unique_lock lock{_mutex};
+                _finished.wait(lock, [this] { return _done; });
+                if(_error)
+                    std::rethrow_exception(_error);
+                if constexpr(!std::is_void_v<T>)
+                    return std::move(*_value);
+            }
+          private:
+            std::optional<std::conditional_t<std::is_void_v<T>, bool, T>> _value;
+            std::exception_ptr _error;
+            std::mutex _mutex;
+            std::condition_variable _finished;
+            bool _done = false;
+        };
+    }
+
+    class scheduler {
+        using clock = std::chrono::steady_clock;
+
+        struct schedule_awaiter {
+            [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> h) const { self->post(h); }
+
+            constexpr void await_resume() const noexcept {}
+
+            scheduler * self;
+        };
+
+        struct timer_awaiter {
+            [[nodiscard]] bool await_ready() const noexcept { return deadline <= clock::now(); }
+
+            void await_suspend(std::coroutine_handle<> h) const { self->add_timer(deadline, h); }
+
+            constexpr void await_resume() const noexcept {}
+
+            scheduler * self;
+            clock::time_point deadline;
+        };
+      public:
+        // registered with the reactor while suspended, the reactor refers to it
+        struct fd_awaiter {
+            [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+            // throws `std::system_error` if `fd` can't be waited for
+            void await_suspend(std::coroutine_handle<> h)
+            {
+                coro = h;
+                self->add_waiter(*this);
+            }
+
+            constexpr void await_resume() const noexcept {}
+
+            scheduler * self;
+            int fd;
+            unsigned events;
+            std::coroutine_handle<> coro;
+        };
+
+        // `threads == 0` uses `std::thread::hardware_concurrency()`
+        explicit scheduler(size_t threads = 0);
+        scheduler(scheduler const &)             = delete;
+        scheduler & operator=(scheduler const &) = delete;
+        // coroutines still suspended on the scheduler (eg. waiting for a timer) are never resumed
+        ~scheduler();
+
+        // number of workers
+        [[nodiscard]] size_t size() const noexcept;
+
+        // resumes the awaiting coroutine on a worker
+        // on a worker it's pushed onto the worker's own deque for idle workers to steal, ie. this forks
+        [[nodiscard]] schedule_awaiter schedule() noexcept { return {this}; }
+
+        // resumes the awaiting coroutine on a worker at (or shortly after) `deadline`
+        [[nodiscard]] timer_awaiter sleep_until(clock::time_point deadline) noexcept { return {this, deadline}; }
+
+        [[nodiscard]] timer_awaiter sleep_for(clock::duration duration) noexcept
+        {
+            return {this, clock::now() + duration};
+        }
+
+        // resumes the awaiting coroutine on a worker once `fd` is readable/writable (or has an error or hung up)
+        // at most one coroutine may wait on a given `fd` at a time
+        [[nodiscard]] fd_awaiter readable(int fd) noexcept;
+        [[nodiscard]] fd_awaiter writable(int fd) noexcept;
+
+        // runs `t` on the scheduler without waiting for it, an exception escaping `t` terminates
+        void spawn(task<void> t);
+
+        // runs `t` on the scheduler and blocks the calling thread (which mustn't be a worker) until it has finished
+        template<typename T>
+        T block_on(task<T> t)
+        {
+            _impl::scheduler::blocker<T> b;
+            run_blocking(*this, std::move(t), b);
+            return b.get();
+        }
+      private:
+        struct state;
+
+        template<typename T>
+        static _impl::scheduler::detached run_blocking(scheduler & self, task<T> t, _impl::scheduler::blocker<T> & b)
+        {
+            try {
+                co_await self.schedule();
+                if constexpr(std::is_void_v<T>) {
+                    co_await std::move(t);
+                    b.set_value();
+                } else {
+                    b.set_value(co_await std::move(t));
+                }
+            } catch(...) {
+                b.set_error(std::current_exception());
+            }
+            b.notify();
+        }
+
+        // makes `h` ready to be resumed on a worker
+        void post(std::coroutine_handle<> h);
+        void add_timer(clock::time_point deadline, std::coroutine_handle<> h);
+        void add_waiter(fd_awaiter & waiter);
+
+        std::unique_ptr<state> _state;
+    };
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef GSTD_COROUTINE_TASK_HPP
+#define GSTD_COROUTINE_TASK_HPP
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// `task<T>` is a lazily started coroutine producing a `T` (or an exception) for the coroutine `co_await`ing it, which
+// is resumed directly (by symmetric transfer) on whichever thread finishes the task.
+// Frames come from per-thread free lists of a few size classes (see src/task.cpp), a frame finished on another thread
+// than the one that created it simply ends up in that thread's lists.
+
+namespace gstd::coroutine {
+    using size_t = decltype(sizeof(nullptr));
+
+    template<typename T = void>
+    class task;
+
+    namespace _impl::task {
+        [[nodiscard]] void * allocate_frame(size_t size);
+        void deallocate_frame(void * frame, size_t size) noexcept;
+
+        // base for promises of coroutines whose frames come from the per-thread free lists
+        struct frame_allocated {
+            [[nodiscard]] static void * operator new(size_t size) { return allocate_frame(size); }
+
+            static void operator delete(void * frame, size_t size) noexcept { deallocate_frame(frame, size); }
+        };
+
+        struct final_awaiter {
+            [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+            template<typename Promise>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> h) noexcept
+            {
+                if(auto continuation = h.promise().continuation)
+                    return continuation;
+                return std::noop_coroutine();
+            }
+
+            constexpr void await_resume() const noexcept {}
+        };
+
+        class promise_base : public frame_allocated {
+          public:
+            [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+            [[nodiscard]] final_awaiter final_suspend() const noexcept { return {}; }
+
+            void unhandled_exception() noexcept { _error = std::current_exception(); }
+
+            // resumed once the task finishes
+            std::coroutine_handle<> continuation;
+          protected:
+            void rethrow() const
+            {
+                if(_error)
+                    std::rethrow_exception(_error);
+            }
+          private:
+            std::exception_ptr _error;
+        };
+
+        template<typename T>
+        class promise : public promise_base {
+          public:
+            [[nodiscard]] coroutine::task<T> get_return_object() noexcept;
+
+            template<typename U = T>
+            requires std::is_convertible_v<U, T>
+            void return_value(U && value) noexcept(std::is_nothrow_constructible_v<T, U>)
+            {
+                _value.emplace(static_cast<U &&>(value));
+            }
+
+            [[nodiscard]] T result()
+            {
+                rethrow();
+                return std::move(*_value);
+            }
+          private:
+            std::optional<T> _value;
+        };
+
+        template<>
+        class promise<void> : public promise_base {
+          public:
+            [[nodiscard]] coroutine::task<void> get_return_object() noexcept;
+
+            constexpr void return_void() const noexcept {}
+
+            void result() const { rethrow(); }
+        };
+    }
+
+    template<typename T>
+    class [[nodiscard]] task {
+        static_assert(std::is_void_v<T> || std::is_object_v<T>);
+      public:
+        using promise_type = _impl::task::promise<T>;
+        using handle       = std::coroutine_handle<promise_type>;
+
+        task() noexcept = default;
+
+        task(task && other) noexcept : _coro{std::exchange(other._coro, nullptr)} {}
+
+        task & operator=(task && rhs) noexcept
+        {
+            std::swap(_coro, rhs._coro);
+            return *this;
+        }
+
+        ~task()
+        {
+            if(_coro)
+                _coro.destroy();
+        }
+
+        // starts the task, the awaiting coroutine is resumed with its result once it has finished
+        [[nodiscard]] auto operator co_await() && noexcept
+        {
+            struct awaiter {
+                [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    coro.promise().continuation = awaiting;
+                    return coro;
+                }
+
+                T await_resume() { return coro.promise().result(); }
+
+                handle coro;
+            };
+
+            return awaiter{_coro};
+        }
+      private:
+        friend promise_type;
+
+        explicit task(handle coro) noexcept : _coro{coro} {}
+
+        handle _coro;
+    };
+
+    template<typename T>
+    task<T> _impl::task::promise<T>::get_return_object() noexcept
+    {
+        return coroutine::task<T>{coroutine::task<T>::handle::from_promise(*this)};
+    }
+
+    inline task<void> _impl::task::promise<void>::get_return_object() noexcept
+    {
+        return coroutine::task<void>{coroutine::task<void>::handle::from_promise(*this)};
+    }
+}
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef GSTD_COROUTINE_WHEN_ALL_HPP
+#define GSTD_COROUTINE_WHEN_ALL_HPP
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+#include "coroutine/task.hpp"
+
+// `co_await when_all(tasks...)` starts every task and resumes once all of them have finished, with a tuple of their
+// results (`std::monostate` for `task<void>`). If any throws, the first exception (in argument order) is rethrown.
+// Tasks are started one after another on the awaiting thread, they run in parallel if they move themselves onto a
+// scheduler (eg. `co_await sched.schedule()`), the last one to finish resumes the awaiting coroutine.
+
+namespace gstd::coroutine {
+    namespace _impl::when_all {
+        template<typename T>
+        using value_t = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+        struct counter {
+            std::atomic<size_t> remaining;
+            std::coroutine_handle<> awaiting;
+        };
+
+        // runs a single task, the last driver to finish resumes the awaiting coroutine
+        class [[nodiscard]] driver {
+          public:
+            struct promise_type : task::frame_allocated {
+                struct final_awaiter {
+                    [[nodiscard]] constexpr bool await_ready() const noexcept { return false; }
+
+                    std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) noexcept
+                    {
+                        auto & c = *h.promise().c;
+                        if(c.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                            return c.awaiting;
+                        return std::noop_coroutine();
+                    }
+
+                    constexpr void await_resume() const noexcept {}
+                };
+
+                [[nodiscard]] driver get_return_object() noexcept
+                {
+                    return driver{std::coroutine_handle<promise_type>::from_promise(*this)};
+                }
+
+                [[nodiscard]] std::suspend_always initial_suspend() const noexcept { return {}; }
+
+                [[nodiscard]] final_awaiter final_suspend() const noexcept { return {}; }
+
+                constexpr void return_void() const noexcept {}
+
+                // drivers catch everything themselves
+                [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+                counter * c = nullptr;
+            };
+
+            driver(driver && other) noexcept : _coro{std::exchange(other._coro, nullptr)} {}
+
+            ~driver()
+            {
+                if(_coro)
+                    _coro.destroy();
+            }
+
+            void start(counter & c) noexcept
+            {
+                _coro.promise().c = &c;
+                _coro.resume();
+            }
+          private:
+            explicit driver(std::coroutine_handle<promise_type> coro) noexcept : _coro{coro} {}
+
+            std::coroutine_handle<promise_type> _coro;
+        };
+
+        template<typename T>
+        struct slot {
+            [[nodiscard]] value_t<T> get()
+            {
+                if(error)
+                    std::rethrow_exception(error);
+                return std::move(*value);
+            }
+
+            std::optional<value_t<T>> value;
+            std::exception_ptr error;
+        };
+
+        template<typename T>
+        driver drive(coroutine::task<T> & t, slot<T> & s)
+        {
+            try {
+                if constexpr(std::is_void_v<T>) {
+                    co_await std::move(t);
+                    s.value.emplace();
+                } else {
+                    s.value.emplace(co_await std::move(t));
+                }
+            } catch(...) {
+                s.error = std::current_exception();
+            }
+        }
+
+        // starts every driver, suspends unless all of them finished synchronously
+        struct join {
+            [[nodiscard]] constexpr bool await_ready() const noexcept { return drivers.empty(); }
+
+            bool await_suspend(std::coroutine_handle<> awaiting) noexcept
+            {
+                c.awaiting = awaiting;
+                c.remaining.store(drivers.size() + 1, std::memory_order_relaxed);
+                for(auto & d : drivers)
+                    d.start(c);
+                return c.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1;
+            }
+
+            constexpr void await_resume() const noexcept {}
+
+            std::span<driver> drivers;
+            counter c{};
+        };
+    }
+
+    template<typename... Ts>
+    task<std::tuple<_impl::when_all::value_t<Ts>...>> when_all(task<Ts>... tasks)
+    {
+        std::tuple<_impl::when_all::slot<Ts>...> slots;
+        std::vector<_impl::when_all::driver> drivers;
+        drivers.reserve(sizeof...(Ts));
+        [&]<size_t... I>(std::index_sequence<I...>) {
+            (drivers.push_back(_impl::when_all::drive(tasks, std::get<I>(slots))), ...);
+        }(std::index_sequence_for<Ts...>{});
+        co_await _impl::when_all::join{drivers};
+        co_return std::apply(
+          [](auto &... s) { return std::tuple<_impl::when_all::value_t<Ts>...>{s.get()...}; }, slots
+        );
+    }
+
+    // results in order, `task<void>` for `task<void>`s
+    template<typename T>
+    task<std::conditional_t<std::is_void_v<T>, void, std::vector<T>>> when_all(std::vector<task<T>> tasks)
+    {
+        std::vector<_impl::when_all::slot<T>> slots(tasks.size());
+        std::vector<_impl::when_all::driver> drivers;
+        drivers.reserve(tasks.size());
+        for(size_t i = 0; i < tasks.size(); ++i)
+            drivers.push_back(_impl::when_all::drive(tasks[i], slots[i]));
+        co_await _impl::when_all::join{drivers};
+        if constexpr(std::is_void_v<T>) {
+            for(auto & s : slots)
+                s.get();
+        } else {
+            std::vector<T> results;
+            results.reserve(slots.size());
+            for(auto & s : slots)
+                results.push_back(s.get());
+            co_return results;
+        }
+    }
+}
+
+#endif
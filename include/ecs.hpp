@@ -0,0 +1,7 @@
+#ifndef GSTD_ECS_HPP
+#define GSTD_ECS_HPP
+
+#include "ecs/archetype.hpp"
+#include "ecs/registry.hpp"
+
+#endif // GSTD_ECS_HPP
@@ -0,0 +1,60 @@
+#ifndef GSTD_ECS_ARCHETYPE_HPP
+#define GSTD_ECS_ARCHETYPE_HPP
+
+#include <cstdint>
+#include <type_traits>
+#include "meta/type_sequence.hpp"
+
+namespace gstd::ecs {
+    using size_t = decltype(sizeof(nullptr));
+
+    // bit `I` is set iff the `I`-th component of the universe is part of the archetype
+    using archetype_id = std::uint64_t;
+
+    namespace _impl {
+        template<typename Universe, meta::type_sequence::sequence_of_types Seq>
+        struct archetype_id_of {};
+
+        template<typename Universe, typename... Ts>
+        struct archetype_id_of<Universe, meta::type_sequence::type_sequence<Ts...>>
+            : std::integral_constant<archetype_id, ((archetype_id{1} << Universe::template index<Ts>) | ...)> {};
+
+        template<typename Universe, typename... Ts>
+        struct canonical_id : archetype_id_of<Universe, typename Universe::template canonical<Ts...>> {};
+
+        template<typename Universe>
+        struct canonical_id<Universe> : std::integral_constant<archetype_id, 0> {};
+    }
+
+    // `Universe` lists every component type a registry can store, its order defines the canonical order
+    template<meta::type_sequence::sequence_of_types Universe>
+    struct component_universe {
+        static_assert(Universe::size <= 64, "archetype_id has one bit per component");
+        static_assert(std::same_as<Universe, typename Universe::unique>, "components must be distinct");
+
+        static constexpr size_t size = Universe::size;
+
+        template<typename T>
+        static constexpr bool contains = Universe::template contains<T>;
+
+        template<typename T>
+        requires contains<T>
+        static constexpr size_t index = Universe::template nth_index<T>;
+
+        template<size_t I>
+        using get = Universe::template get<I>;
+
+        template<typename T, typename U>
+        struct order : std::bool_constant<(index<T> < index<U>)> {};
+
+        // `canonical<B, A, B>` and `canonical<A, B>` name the same type
+        template<typename... Ts>
+        requires (sizeof...(Ts) > 0 && (contains<Ts> && ...))
+        using canonical = meta::type_sequence::type_sequence<Ts...>::unique::template sorted<order>;
+
+        template<typename... Ts>
+        static constexpr archetype_id id = _impl::canonical_id<component_universe, Ts...>::value;
+    };
+}
+
+#endif
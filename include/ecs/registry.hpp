@@ -0,0 +1,365 @@
+#ifndef GSTD_ECS_REGISTRY_HPP
+#define GSTD_ECS_REGISTRY_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+#include "ecs/archetype.hpp"
+
+namespace gstd::ecs {
+    struct entity {
+        std::uint32_t index;
+        std::uint32_t generation;
+
+        [[nodiscard]] friend constexpr bool operator==(entity, entity) noexcept = default;
+    };
+
+    inline constexpr entity null_entity{~std::uint32_t{0}, 0};
+
+    // Entities with the same set of components share an archetype.
+    // An archetype stores its rows in fixed-size chunks taken from `Alloc`, each chunk is laid out as
+    // `[entity...][component 0...][component 1...]...` (structure of arrays, columns in canonical order).
+    // Rows are kept dense (erasing moves the last row into the hole), so iteration is a linear scan per column.
+    template<
+      meta::type_sequence::sequence_of_types Components,
+      allocation::allocator Alloc = allocation::c_allocator_type,
+      size_t ChunkSize            = 16 * 1024>
+    class registry {
+        using universe = component_universe<Components>;
+
+        template<size_t I>
+        using component = universe::template get<I>;
+
+        template<typename T>
+        static constexpr bool storable = std::is_nothrow_move_constructible_v<T>
+                                         && std::is_nothrow_destructible_v<T>
+                                         && alignof(T) <= alignof(std::max_align_t);
+
+        static_assert(universe::size > 0);
+        static_assert(Components::template all<std::is_object>);
+        static_assert(
+          []<size_t... Is>(std::index_sequence<Is...>) { return (storable<component<Is>> && ...); }(
+            std::make_index_sequence<universe::size>{}
+          ),
+          "components must be nothrow movable and not over-aligned"
+        );
+        static_assert(
+          []<size_t... Is>(std::index_sequence<Is...>) {
+              return sizeof(entity) + ((sizeof(component<Is>) + alignof(component<Is>)) + ...) <= ChunkSize;
+          }(std::make_index_sequence<universe::size>{}),
+          "a chunk must be able to hold at least one row of every archetype"
+        );
+
+        static constexpr std::uint32_t no_archetype = ~std::uint32_t{0};
+
+        struct archetype {
+            archetype_id id;
+            size_t capacity; // rows per chunk
+            size_t size;     // rows in total
+            size_t offsets[universe::size];
+            std::vector<allocation::allocation_result> chunks;
+        };
+
+        struct record {
+            std::uint32_t archetype;
+            std::uint32_t row;
+            std::uint32_t generation;
+        };
+      public:
+        explicit registry(Alloc alloc = Alloc{}) noexcept(std::is_nothrow_move_constructible_v<Alloc>)
+            : _alloc(std::move(alloc))
+        {}
+
+        registry(registry &&) = default;
+
+        ~registry()
+        {
+            for(auto & a : _archetypes) {
+                for(size_t row = 0; row < a.size; ++row)
+                    destroy_row(a, row);
+                for(auto chunk : a.chunks)
+                    _alloc.deallocate(chunk);
+            }
+        }
+
+        registry(registry const &)       = delete;
+        void operator=(registry const &) = delete;
+
+        // number of alive entities
+        [[nodiscard]] size_t size() const noexcept { return _records.size() - _free.size(); }
+
+        [[nodiscard]] size_t archetype_count() const noexcept { return _archetypes.size(); }
+
+        [[nodiscard]] bool alive(entity e) const noexcept
+        {
+            return e.index < _records.size() && _records[e.index].generation == e.generation
+                && _records[e.index].archetype != no_archetype;
+        }
+
+        template<typename... Ts>
+        requires (universe::template contains<std::remove_cvref_t<Ts>> && ...)
+        entity create(Ts &&... components)
+        {
+            constexpr archetype_id id = universe::template id<std::remove_cvref_t<Ts>...>;
+            static_assert(std::popcount(id) == sizeof...(Ts), "components must be distinct");
+            if constexpr(!(std::is_nothrow_constructible_v<std::remove_cvref_t<Ts>, Ts> && ...)) {
+                // copy before touching any storage, so a throwing copy leaves `*this` untouched
+                return [this](std::remove_cvref_t<Ts> &&... values) {
+                    return create(std::move(values)...);
+                }(std::remove_cvref_t<Ts>(static_cast<Ts &&>(components))...);
+            } else {
+                auto index = archetype_index(id);
+                auto & a   = _archetypes[index];
+                // everything that may throw happens before the entity is taken
+                reserve_row(a);
+                auto e   = new_entity();
+                auto row = push_row(a, e);
+                (::new(column<std::remove_cvref_t<Ts>>(a, row))
+                   std::remove_cvref_t<Ts>(static_cast<Ts &&>(components)),
+                 ...);
+                _records[e.index] = {index, static_cast<std::uint32_t>(row), e.generation};
+                return e;
+            }
+        }
+
+        void destroy(entity e) noexcept
+        {
+            if(!alive(e))
+                return;
+            auto & rec = _records[e.index];
+            auto & a   = _archetypes[rec.archetype];
+            destroy_row(a, rec.row);
+            erase_row(a, rec.row);
+            rec.archetype = no_archetype;
+            ++rec.generation;
+            _free.push_back(e.index);
+        }
+
+        template<typename T>
+        requires universe::template contains<T>
+        [[nodiscard]] bool has(entity e) const noexcept
+        {
+            return alive(e) && (_archetypes[_records[e.index].archetype].id & universe::template id<T>);
+        }
+
+        // `nullptr` if `e` isn't alive or doesn't have a `T`
+        template<typename T>
+        requires universe::template contains<std::remove_const_t<T>>
+        [[nodiscard]] T * get(entity e) noexcept
+        {
+            if(!has<std::remove_const_t<T>>(e))
+                return nullptr;
+            auto & rec = _records[e.index];
+            return column<std::remove_const_t<T>>(_archetypes[rec.archetype], rec.row);
+        }
+
+        // constructs (or replaces) the `T` of `e` (which must be alive)
+        // moves `e` to another archetype in O(components) if necessary
+        template<typename T, typename... Args>
+        requires universe::template contains<T>
+        T & emplace(entity e, Args &&... args)
+        {
+            // constructed before touching any storage: a throwing constructor leaves `*this` untouched and `args` may
+            // refer to components of `e` (including the one being replaced)
+            T value(static_cast<Args &&>(args)...);
+            auto & rec = _records[e.index];
+            if(auto ptr = get<T>(e)) {
+                ptr->~T();
+                return *::new(ptr) T(std::move(value));
+            }
+            move_to(e, _archetypes[rec.archetype].id | universe::template id<T>);
+            return *::new(column<T>(_archetypes[rec.archetype], rec.row)) T(std::move(value));
+        }
+
+        template<typename T>
+        requires universe::template contains<T>
+        void remove(entity e)
+        {
+            if(has<T>(e))
+                move_to(e, _archetypes[_records[e.index].archetype].id & ~universe::template id<T>);
+        }
+
+        // invokes `f(Ts &...)` or `f(entity, Ts &...)` for every entity with (at least) the components `Ts...`
+        // creating, destroying or changing the components of entities during iteration is undefined behavior
+        template<typename... Ts, typename F>
+        requires (universe::template contains<std::remove_const_t<Ts>> && ...)
+        void each(F && f)
+        {
+            constexpr archetype_id required = universe::template id<std::remove_const_t<Ts>...>;
+            for(auto & a : _archetypes) {
+                if((a.id & required) != required)
+                    continue;
+                auto rows = a.size;
+                for(auto chunk : a.chunks) {
+                    if(!rows)
+                        break;
+                    auto count = std::min(rows, a.capacity);
+                    rows      -= count;
+                    auto base  = static_cast<char *>(chunk.ptr);
+                    each_in_chunk(
+                      f, reinterpret_cast<entity const *>(base), count,
+                      reinterpret_cast<Ts *>(base + a.offsets[universe::template index<std::remove_const_t<Ts>>])...
+                    );
+                }
+            }
+        }
+      private:
+        template<typename F, typename... Ts>
+        static void each_in_chunk(F & f, entity const * entities, size_t count, Ts * __restrict... columns)
+        {
+            for(size_t i = 0; i < count; ++i) {
+                if constexpr(std::is_invocable_v<F &, entity, Ts &...>)
+                    f(entities[i], columns[i]...);
+                else
+                    f(columns[i]...);
+            }
+        }
+
+        // invokes `f.template operator()<I>()` for every component index `I` in `id`
+        template<typename F>
+        static void visit(archetype_id id, F && f)
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>) {
+                ((id >> Is & 1 ? f.template operator()<Is>() : void()), ...);
+            }(std::make_index_sequence<universe::size>{});
+        }
+
+        template<typename T>
+        static T * column(archetype & a, size_t row) noexcept
+        {
+            auto base = static_cast<char *>(a.chunks[row / a.capacity].ptr);
+            return reinterpret_cast<T *>(base + a.offsets[universe::template index<T>]) + row % a.capacity;
+        }
+
+        static entity * entity_column(archetype & a, size_t row) noexcept
+        {
+            return static_cast<entity *>(a.chunks[row / a.capacity].ptr) + row % a.capacity;
+        }
+
+        static archetype make_archetype(archetype_id id)
+        {
+            archetype a{id, 0, 0, {}, {}};
+            size_t row_size{sizeof(entity)};
+            visit(id, [&]<size_t I> { row_size += sizeof(component<I>); });
+            // shrink until the alignment padding fits as well
+            for(a.capacity = ChunkSize / row_size;; --a.capacity) {
+                auto offset = a.capacity * sizeof(entity);
+                visit(id, [&]<size_t I> {
+                    using C      = component<I>;
+                    offset       = (offset + alignof(C) - 1) & ~(alignof(C) - 1);
+                    a.offsets[I] = offset;
+                    offset      += a.capacity * sizeof(C);
+                });
+                if(offset <= ChunkSize)
+                    return a;
+            }
+        }
+
+        std::uint32_t archetype_index(archetype_id id)
+        {
+            if(auto it = _lookup.find(id); it != _lookup.end())
+                return it->second;
+            // only looked up once it exists
+            auto index = static_cast<std::uint32_t>(_archetypes.size());
+            _archetypes.push_back(make_archetype(id));
+            try {
+                _lookup.emplace(id, index);
+            } catch(...) {
+                _archetypes.pop_back();
+                throw;
+            }
+            return index;
+        }
+
+        entity new_entity()
+        {
+            if(_free.empty()) {
+                _records.push_back({no_archetype, 0, 0});
+                return {static_cast<std::uint32_t>(_records.size() - 1), 0};
+            }
+            auto index = _free.back();
+            _free.pop_back();
+            return {index, _records[index].generation};
+        }
+
+        // makes room for another row
+        void reserve_row(archetype & a)
+        {
+            if(a.size < a.chunks.size() * a.capacity)
+                return;
+            a.chunks.reserve(a.chunks.size() + 1);
+            auto chunk = _alloc.allocate(ChunkSize);
+            if(!chunk)
+                throw std::bad_alloc{};
+            a.chunks.push_back(chunk);
+        }
+
+        size_t push_row(archetype & a, entity e)
+        {
+            reserve_row(a);
+            *entity_column(a, a.size) = e;
+            return a.size++;
+        }
+
+        static void destroy_row(archetype & a, size_t row) noexcept
+        {
+            visit(a.id, [&]<size_t I> {
+                using C = component<I>;
+                if constexpr(!std::is_trivially_destructible_v<C>)
+                    column<C>(a, row)->~C();
+            });
+        }
+
+        // `row` must already be destroyed, the last row is moved into its place
+        void erase_row(archetype & a, size_t row) noexcept
+        {
+            auto last = --a.size;
+            if(row == last)
+                return;
+            visit(a.id, [&]<size_t I> {
+                using C   = component<I>;
+                auto from = column<C>(a, last);
+                ::new(column<C>(a, row)) C(std::move(*from));
+                from->~C();
+            });
+            auto moved                = *entity_column(a, last);
+            *entity_column(a, row)    = moved;
+            _records[moved.index].row = static_cast<std::uint32_t>(row);
+        }
+
+        void move_to(entity e, archetype_id id)
+        {
+            auto & rec = _records[e.index];
+            auto dst_i = archetype_index(id); // may invalidate references into `_archetypes`
+            auto & src = _archetypes[rec.archetype];
+            auto & dst = _archetypes[dst_i];
+            auto row   = push_row(dst, e);
+            visit(src.id, [&]<size_t I> {
+                using C   = component<I>;
+                auto from = column<C>(src, rec.row);
+                if(dst.id >> I & 1)
+                    ::new(column<C>(dst, row)) C(std::move(*from));
+                from->~C();
+            });
+            erase_row(src, rec.row);
+            rec.archetype = dst_i;
+            rec.row       = static_cast<std::uint32_t>(row);
+        }
+
+        [[no_unique_address]] Alloc _alloc;
+        std::vector<archetype> _archetypes;
+        std::unordered_map<archetype_id, std::uint32_t> _lookup;
+        std::vector<record> _records;
+        std::vector<std::uint32_t> _free;
+    };
+}
+
+#endif
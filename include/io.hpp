@@ -0,0 +1,7 @@
+#ifndef GSTD_IO_HPP
+#define GSTD_IO_HPP
+
+#include "io/byte_ring.hpp"
+#include "io/mapped_file.hpp"
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef GSTD_IO_BYTE_RING_HPP
+#define GSTD_IO_BYTE_RING_HPP
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace gstd::io {
+    using size_t = decltype(sizeof(nullptr));
+
+    // FIFO of bytes whose pages are mapped twice, back to back (see src/byte_ring.cpp), so the buffered bytes and the
+    // free space after them are always contiguous, even once they wrap around
+    // the buffered bytes are a contiguous range of `char`
+    class byte_ring {
+      public:
+        byte_ring() noexcept = default;
+        // room for at least `capacity` bytes (rounded up to whole pages)
+        // throws `std::system_error` if the memory can't be mapped
+        explicit byte_ring(size_t capacity);
+
+        byte_ring(byte_ring && other) noexcept
+            : _data{std::exchange(other._data, nullptr)}, _capacity{std::exchange(other._capacity, 0)}
+            , _head{std::exchange(other._head, 0)}, _size{std::exchange(other._size, 0)}
+        {}
+
+        byte_ring & operator=(byte_ring && rhs) noexcept
+        {
+            std::swap(_data, rhs._data);
+            std::swap(_capacity, rhs._capacity);
+            std::swap(_head, rhs._head);
+            std::swap(_size, rhs._size);
+            return *this;
+        }
+
+        ~byte_ring();
+
+        [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
+
+        // buffered bytes
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+
+        [[nodiscard]] bool empty() const noexcept { return !_size; }
+
+        [[nodiscard]] bool full() const noexcept { return _size == _capacity; }
+
+        [[nodiscard]] char * data() noexcept { return _data + _head; }
+
+        [[nodiscard]] char const * data() const noexcept { return _data + _head; }
+
+        [[nodiscard]] char * begin() noexcept { return data(); }
+
+        [[nodiscard]] char const * begin() const noexcept { return data(); }
+
+        [[nodiscard]] char * end() noexcept { return data() + _size; }
+
+        [[nodiscard]] char const * end() const noexcept { return data() + _size; }
+
+        // drops the first `n` (at most `size()`) buffered bytes
+        void consume(size_t n) noexcept
+        {
+            _head += n;
+            _size -= n;
+            if(_head >= _capacity)
+                _head -= _capacity;
+        }
+
+        // free space right after the buffered bytes, to be filled (eg. by `read(2)`) and then `commit`ted
+        [[nodiscard]] std::span<char> writable() noexcept { return {end(), _capacity - _size}; }
+
+        // appends the first `n` (at most `writable().size()`) bytes of `writable()`
+        void commit(size_t n) noexcept { _size += n; }
+
+        // appends as many of the `size` bytes at `bytes` as fit, returns how many
+        size_t write(void const * bytes, size_t size) noexcept;
+      private:
+        char * _data     = nullptr;
+        size_t _capacity = 0;
+        // offset of the first buffered byte, less than `_capacity`
+        size_t _head = 0;
+        size_t _size = 0;
+    };
+}
+
+#endif
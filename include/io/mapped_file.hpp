@@ -0,0 +1,57 @@
+#ifndef GSTD_IO_MAPPED_FILE_HPP
+#define GSTD_IO_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <utility>
+
+namespace gstd::io {
+    using size_t = decltype(sizeof(nullptr));
+
+    // access pattern hints, see `madvise(2)`
+    enum class advice {
+        normal,
+        sequential, // read ahead aggressively, pages may be freed soon after being read
+        random,     // don't read ahead
+        will_need,  // start reading in the background now
+        dont_need,  // pages may be dropped (they're re-read from the file on access)
+    };
+
+    // read-only memory mapping of an entire file, a contiguous range of `char const`
+    // throws `std::system_error` if the file can't be opened or mapped
+    class mapped_file {
+      public:
+        mapped_file() noexcept = default;
+        explicit mapped_file(char const * path, advice hint = advice::normal);
+
+        mapped_file(mapped_file && other) noexcept
+            : _data{std::exchange(other._data, nullptr)}, _size{std::exchange(other._size, 0)}
+        {}
+
+        mapped_file & operator=(mapped_file && rhs) noexcept
+        {
+            std::swap(_data, rhs._data);
+            std::swap(_size, rhs._size);
+            return *this;
+        }
+
+        ~mapped_file();
+
+        // applies to [offset, offset + length) (rounded to whole pages), clamped to the file
+        void advise(advice hint, size_t offset = 0, size_t length = static_cast<size_t>(-1)) const noexcept;
+
+        [[nodiscard]] char const * data() const noexcept { return _data; }
+
+        [[nodiscard]] size_t size() const noexcept { return _size; }
+
+        [[nodiscard]] bool empty() const noexcept { return !_size; }
+
+        [[nodiscard]] char const * begin() const noexcept { return _data; }
+
+        [[nodiscard]] char const * end() const noexcept { return _data + _size; }
+      private:
+        char const * _data = nullptr;
+        size_t _size       = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef GSTD_PARALLEL_HPP
+#define GSTD_PARALLEL_HPP
+
+#include "parallel/algorithm.hpp"
+#include "parallel/mpmc_queue.hpp"
+#include "parallel/spsc_ring.hpp"
+#include "parallel/thread_pool.hpp"
+
+#endif
@@ -0,0 +1,460 @@
+#ifndef GSTD_PARALLEL_ALGORITHM_HPP
+#define GSTD_PARALLEL_ALGORITHM_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+#include "parallel/thread_pool.hpp"
+#include "ranges/access.hpp"
+#include "ranges/concepts.hpp"
+#include "ranges/radix_sort.hpp"
+#include "utility/static_const.hpp"
+
+// Parallel algorithms over random-access ranges, every overload without a pool uses `thread_pool::global()`.
+// Element-wise work is split lazily (see `_impl::split`), reductions and scans use a fixed number of chunks per
+// worker so results don't depend on scheduling (`reduce`/`op` still have to be associative).
+
+namespace gstd::parallel {
+    namespace _impl {
+        // value-initialized array in the calling worker's scratch memory, freed in reverse order of allocation
+        template<typename T>
+        class scratch_array {
+            static constexpr size_t alignment = alignof(std::max_align_t);
+            static_assert(alignof(T) <= alignment);
+          public:
+            scratch_array(thread_pool & pool, size_t size) : _alloc{pool.scratch()}, _size{size}
+            {
+                // rounding up keeps the arena aligned (and never requests 0 bytes)
+                _allocation = _alloc.allocate((size * sizeof(T) / alignment + 1) * alignment);
+                if(!_allocation)
+                    throw std::bad_alloc{};
+                _data = static_cast<T *>(_allocation.ptr);
+                try {
+                    std::uninitialized_value_construct_n(_data, size);
+                } catch(...) {
+                    _alloc.deallocate(_allocation);
+                    throw;
+                }
+            }
+
+            scratch_array(scratch_array const &)            = delete;
+            scratch_array & operator=(scratch_array const &) = delete;
+
+            ~scratch_array()
+            {
+                std::destroy_n(_data, _size);
+                _alloc.deallocate(_allocation);
+            }
+
+            [[nodiscard]] T & operator[](size_t i) noexcept { return _data[i]; }
+
+            [[nodiscard]] T * begin() noexcept { return _data; }
+
+            [[nodiscard]] T * end() noexcept { return _data + _size; }
+          private:
+            scratch_allocator & _alloc;
+            allocation::allocation_result _allocation;
+            T * _data;
+            size_t _size;
+        };
+
+        // chunks per worker for reductions, scans and partitioning
+        inline constexpr size_t chunks_per_worker = 8;
+        // below this many elements per chunk, the serial algorithm is used instead
+        inline constexpr size_t min_partition_chunk = 1 << 14;
+        inline constexpr size_t min_sort_grain      = 1 << 11;
+        inline constexpr size_t min_radix_chunk     = 1 << 16;
+
+        [[nodiscard]] inline size_t chunk_count(thread_pool & pool, size_t size, size_t min_chunk = 1) noexcept
+        {
+            return std::clamp<size_t>(size / min_chunk, 1, pool.size() * chunks_per_worker);
+        }
+
+        // [begin, end) of chunk `i` out of `chunks` in `size` elements
+        [[nodiscard]] constexpr std::pair<size_t, size_t> chunk(size_t size, size_t chunks, size_t i) noexcept
+        {
+            return {size * i / chunks, size * (i + 1) / chunks};
+        }
+
+        // calls `fn(lo, hi)` on consecutive pieces of [first, last) of at most `grain` elements
+        // the remainder is only forked off while the calling worker's previous fork has been stolen (lazy binary
+        // splitting), so busy pools process long runs without any task overhead
+        template<typename F>
+        void split(thread_pool & pool, size_t first, size_t last, size_t grain, F & fn)
+        {
+            while(last - first > grain) {
+                if(pool.starving()) {
+                    auto mid = first + (last - first) / 2;
+                    pool.join([&] { split(pool, first, mid, grain, fn); }, [&] { split(pool, mid, last, grain, fn); });
+                    return;
+                }
+                fn(first, first + grain);
+                first += grain;
+            }
+            if(first != last)
+                fn(first, last);
+        }
+
+        template<typename It>
+        [[nodiscard]] constexpr It nth(It it, size_t n)
+        {
+            return it + static_cast<std::iter_difference_t<It>>(n);
+        }
+
+        // number of elements in [first, first + size) satisfying `pred`, which are moved in front of those that don't
+        template<typename It, typename Pred>
+        size_t partition(thread_pool & pool, It first, size_t size, Pred & pred)
+        {
+            auto chunks = chunk_count(pool, size, min_partition_chunk);
+            if(chunks == 1)
+                return static_cast<size_t>(std::partition(first, nth(first, size), std::ref(pred)) - first);
+            // partition every chunk on its own, then swap the chunks' misplaced elements:
+            // elements failing `pred` in front of `total` and those satisfying it behind `total`, equally many of each
+            scratch_array<size_t> satisfied{pool, chunks};
+            auto partition_chunks = [&](size_t lo, size_t hi) {
+                for(auto c = lo; c < hi; ++c) {
+                    auto [b, e]  = chunk(size, chunks, c);
+                    auto middle  = std::partition(nth(first, b), nth(first, e), std::ref(pred));
+                    satisfied[c] = static_cast<size_t>(middle - nth(first, b));
+                }
+            };
+            split(pool, 0, chunks, 1, partition_chunks);
+            size_t total = 0;
+            for(auto n : satisfied)
+                total += n;
+            // misplaced elements of chunk `c` are `[failing_begin(c), ...)` and `[satisfying_begin(c), ...)`
+            auto failing_begin    = [&](size_t c) { return chunk(size, chunks, c).first + satisfied[c]; };
+            auto satisfying_begin = [&](size_t c) { return std::max(chunk(size, chunks, c).first, total); };
+            scratch_array<size_t> failing{pool, chunks + 1}, satisfying{pool, chunks + 1};
+            for(size_t c = 0; c < chunks; ++c) {
+                auto [b, e]       = chunk(size, chunks, c);
+                auto fb           = failing_begin(c);
+                auto fe           = std::min(e, total);
+                auto sb           = satisfying_begin(c);
+                auto se           = b + satisfied[c];
+                failing[c + 1]    = failing[c] + (fb < fe ? fe - fb : 0);
+                satisfying[c + 1] = satisfying[c] + (sb < se ? se - sb : 0);
+            }
+            auto swap_misplaced = [&](size_t lo, size_t hi) {
+                // index of the interval containing the `k`-th misplaced element
+                auto locate = [&](scratch_array<size_t> & prefix, size_t k) {
+                    return static_cast<size_t>(std::upper_bound(prefix.begin(), prefix.end(), k) - prefix.begin() - 1);
+                };
+                auto f = locate(failing, lo);
+                auto s = locate(satisfying, lo);
+                for(auto k = lo; k < hi; ++k) {
+                    while(failing[f + 1] <= k)
+                        ++f;
+                    while(satisfying[s + 1] <= k)
+                        ++s;
+                    std::ranges::iter_swap(
+                      nth(first, failing_begin(f) + (k - failing[f])),
+                      nth(first, satisfying_begin(s) + (k - satisfying[s]))
+                    );
+                }
+            };
+            auto misplaced = failing[chunks];
+            auto grain     = std::max<size_t>(misplaced / (pool.size() * chunks_per_worker), 1);
+            split(pool, 0, misplaced, grain, swap_misplaced);
+            return total;
+        }
+
+        // quicksort with parallel partitioning and recursion, `std::sort` for small or degenerate partitions
+        template<typename It, typename Comp>
+        void sort(thread_pool & pool, It first, size_t size, Comp & comp, size_t grain, int depth)
+        {
+            if(size <= grain || depth == 0) {
+                std::sort(first, nth(first, size), std::ref(comp));
+                return;
+            }
+            auto a = first[0], b = first[static_cast<std::iter_difference_t<It>>(size / 2)], c = *nth(first, size - 1);
+            auto pivot = std::invoke(comp, a, b) ? (std::invoke(comp, b, c) ? b : std::invoke(comp, a, c) ? c : a)
+                                                 : (std::invoke(comp, a, c) ? a : std::invoke(comp, b, c) ? c : b);
+            auto less  = [&](auto const & x) { return std::invoke(comp, x, pivot); };
+            auto equal = [&](auto const & x) { return !std::invoke(comp, pivot, x); };
+            auto lower = partition(pool, first, size, less);
+            // `pivot` itself is equal, so both halves shrink
+            auto middle = lower + partition(pool, nth(first, lower), size - lower, equal);
+            pool.join(
+              [&] { sort(pool, first, lower, comp, grain, depth - 1); },
+              [&] { sort(pool, nth(first, middle), size - middle, comp, grain, depth - 1); }
+            );
+        }
+
+        // LSD radix sort (see ranges/radix_sort.hpp), every pass counts the digit per chunk in parallel and then
+        // scatters the chunks in parallel, each to its own offsets
+        template<typename T, typename Proj, typename Alloc>
+        void radix_sort(thread_pool & pool, T * data, size_t size, Alloc & alloc, Proj & proj)
+        {
+            namespace radix = ranges::_impl::radix;
+            using K         = radix::key_t<T, Proj>;
+            using histogram = radix::histogram<K>;
+            auto chunks     = chunk_count(pool, size, min_radix_chunk);
+            if(chunks == 1) {
+                radix::sort(data, size, alloc, proj);
+                return;
+            }
+            constexpr auto n = radix::passes<K>;
+            radix::buffer<T, Alloc> buffer{alloc, size};
+            pool.run([&] {
+                // all digits at once to skip trivial passes
+                scratch_array<std::array<histogram, n>> all{pool, chunks};
+                auto count_all = [&](size_t lo, size_t hi) {
+                    for(auto c = lo; c < hi; ++c) {
+                        auto [b, e] = chunk(size, chunks, c);
+                        radix::histograms(static_cast<T const *>(data + b), e - b, proj, all[c].data());
+                    }
+                };
+                split(pool, 0, chunks, 1, count_all);
+                scratch_array<std::array<size_t, radix::radix<K>>> offsets{pool, chunks};
+                T * from = data;
+                T * to   = buffer.data();
+                for(size_t pass = 0; pass < n; ++pass) {
+                    histogram total{};
+                    for(auto & h : all)
+                        for(size_t d = 0; d < radix::radix<K>; ++d)
+                            total[d] += h[pass][d];
+                    if(radix::trivial<K>(total, size))
+                        continue;
+                    auto count = [&](size_t lo, size_t hi) {
+                        for(auto c = lo; c < hi; ++c) {
+                            auto [b, e] = chunk(size, chunks, c);
+                            offsets[c].fill(0);
+                            for(auto it = static_cast<T const *>(from) + b; it != from + e; ++it)
+                                ++offsets[c][radix::digit<K>(radix::encode<K>(std::invoke(proj, *it)), pass)];
+                        }
+                    };
+                    split(pool, 0, chunks, 1, count);
+                    // chunk `c`'s elements with digit `d` go behind those of lower digits and earlier chunks
+                    for(size_t d = 0, sum = 0; d < radix::radix<K>; ++d)
+                        for(auto & o : offsets)
+                            o[d] = std::exchange(sum, sum + o[d]);
+                    auto scatter = [&](size_t lo, size_t hi) {
+                        for(auto c = lo; c < hi; ++c) {
+                            auto [b, e] = chunk(size, chunks, c);
+                            radix::scatter(static_cast<T const *>(from + b), e - b, to, proj, pass, offsets[c].data());
+                        }
+                    };
+                    split(pool, 0, chunks, 1, scatter);
+                    std::swap(from, to);
+                }
+                if(from != data) {
+                    auto copy = [&](size_t lo, size_t hi) {
+                        std::memcpy(data + lo, from + lo, (hi - lo) * sizeof(T));
+                    };
+                    split(pool, 0, size, std::max<size_t>(size / (pool.size() * chunks_per_worker), 1), copy);
+                }
+            });
+        }
+
+        template<typename R>
+        [[nodiscard]] size_t size(R & rng)
+        {
+            return static_cast<size_t>(ranges::size(rng));
+        }
+    }
+
+    namespace _impl::algorithm {
+        struct for_each_fn {
+            template<ranges::random_access_range R, typename F>
+            GSTD_STATIC void operator()(thread_pool & pool, R && rng, F fn) GSTD_CONST
+            {
+                auto first = ranges::begin(rng);
+                auto size  = _impl::size(rng);
+                auto body  = [&](size_t lo, size_t hi) {
+                    for(auto it = nth(first, lo), last = nth(first, hi); it != last; ++it)
+                        std::invoke(fn, *it);
+                };
+                auto grain = std::max<size_t>(size / (pool.size() * 32), 1);
+                pool.run([&] { split(pool, 0, size, grain, body); });
+            }
+
+            template<ranges::random_access_range R, typename F>
+            GSTD_STATIC void operator()(R && rng, F fn) GSTD_CONST
+            {
+                for_each_fn{}(thread_pool::global(), static_cast<R &&>(rng), std::move(fn));
+            }
+        };
+
+        struct transform_reduce_fn {
+            template<ranges::random_access_range R, typename T, typename Reduce, typename Transform>
+            GSTD_STATIC T operator()(thread_pool & pool, R && rng, T init, Reduce reduce, Transform transform)
+              GSTD_CONST
+            {
+                auto first = ranges::begin(rng);
+                auto size  = _impl::size(rng);
+                if(size == 0)
+                    return init;
+                pool.run([&] {
+                    auto chunks = chunk_count(pool, size);
+                    scratch_array<std::optional<T>> partial{pool, chunks};
+                    auto body = [&](size_t lo, size_t hi) {
+                        for(auto c = lo; c < hi; ++c) {
+                            auto [b, e] = chunk(size, chunks, c);
+                            T acc       = std::invoke(transform, *nth(first, b));
+                            for(auto it = nth(first, b + 1), last = nth(first, e); it != last; ++it)
+                                acc = std::invoke(reduce, std::move(acc), std::invoke(transform, *it));
+                            partial[c].emplace(std::move(acc));
+                        }
+                    };
+                    split(pool, 0, chunks, 1, body);
+                    for(auto & p : partial)
+                        init = std::invoke(reduce, std::move(init), std::move(*p));
+                });
+                return init;
+            }
+
+            template<ranges::random_access_range R, typename T, typename Reduce, typename Transform>
+            GSTD_STATIC T operator()(R && rng, T init, Reduce reduce, Transform transform) GSTD_CONST
+            {
+                return transform_reduce_fn{}(
+                  thread_pool::global(),
+                  static_cast<R &&>(rng),
+                  std::move(init),
+                  std::move(reduce),
+                  std::move(transform)
+                );
+            }
+        };
+
+        // writes the inclusive prefix "sums" to `out` (which may be `ranges::begin(rng)`) and returns its end
+        struct inclusive_scan_fn {
+            template<ranges::random_access_range R, std::random_access_iterator Out, typename Op = std::plus<>>
+            GSTD_STATIC Out operator()(thread_pool & pool, R && rng, Out out, Op op = {}) GSTD_CONST
+            {
+                using V    = ranges::range_value_t<R>;
+                auto first = ranges::begin(rng);
+                auto size  = _impl::size(rng);
+                if(size == 0)
+                    return out;
+                pool.run([&] {
+                    auto chunks = chunk_count(pool, size);
+                    scratch_array<std::optional<V>> sums{pool, chunks};
+                    auto reduce_chunks = [&](size_t lo, size_t hi) {
+                        for(auto c = lo; c < hi; ++c) {
+                            auto [b, e] = chunk(size, chunks, c);
+                            V acc       = *nth(first, b);
+                            for(auto it = nth(first, b + 1), last = nth(first, e); it != last; ++it)
+                                acc = std::invoke(op, std::move(acc), *it);
+                            sums[c].emplace(std::move(acc));
+                        }
+                    };
+                    split(pool, 0, chunks, 1, reduce_chunks);
+                    for(size_t c = 1; c < chunks; ++c)
+                        *sums[c] = std::invoke(op, *sums[c - 1], std::move(*sums[c]));
+                    auto scan_chunks = [&](size_t lo, size_t hi) {
+                        for(auto c = lo; c < hi; ++c) {
+                            auto [b, e] = chunk(size, chunks, c);
+                            auto it     = nth(first, b);
+                            auto dest   = nth(out, b);
+                            V acc       = c ? std::invoke(op, *sums[c - 1], *it) : V(*it);
+                            *dest       = acc;
+                            for(auto last = nth(first, e); ++it != last;) {
+                                acc     = std::invoke(op, std::move(acc), *it);
+                                *++dest = acc;
+                            }
+                        }
+                    };
+                    split(pool, 0, chunks, 1, scan_chunks);
+                });
+                return nth(out, size);
+            }
+
+            template<ranges::random_access_range R, std::random_access_iterator Out, typename Op = std::plus<>>
+            GSTD_STATIC Out operator()(R && rng, Out out, Op op = {}) GSTD_CONST
+            {
+                return inclusive_scan_fn{}(thread_pool::global(), static_cast<R &&>(rng), out, std::move(op));
+            }
+        };
+
+        // unstable, returns the first element not satisfying `pred`
+        struct partition_fn {
+            template<ranges::random_access_range R, typename Pred>
+            GSTD_STATIC ranges::iterator_t<R> operator()(thread_pool & pool, R && rng, Pred pred) GSTD_CONST
+            {
+                auto first = ranges::begin(rng);
+                auto size  = _impl::size(rng);
+                size_t satisfied;
+                pool.run([&] { satisfied = partition(pool, first, size, pred); });
+                return nth(first, satisfied);
+            }
+
+            template<ranges::random_access_range R, typename Pred>
+            GSTD_STATIC ranges::iterator_t<R> operator()(R && rng, Pred pred) GSTD_CONST
+            {
+                return partition_fn{}(thread_pool::global(), static_cast<R &&>(rng), std::move(pred));
+            }
+        };
+
+        // unstable, elements have to be copyable (pivots are copied)
+        struct sort_fn {
+            template<ranges::random_access_range R, typename Comp = std::ranges::less>
+            requires std::copy_constructible<ranges::range_value_t<R>>
+            GSTD_STATIC void operator()(thread_pool & pool, R && rng, Comp comp = {}) GSTD_CONST
+            {
+                auto first = ranges::begin(rng);
+                auto size  = _impl::size(rng);
+                auto grain = std::max(size / (pool.size() * chunks_per_worker), min_sort_grain);
+                auto depth = 2 * std::bit_width(size);
+                pool.run([&] { sort(pool, first, size, comp, grain, static_cast<int>(depth)); });
+            }
+
+            template<ranges::random_access_range R, typename Comp = std::ranges::less>
+            requires std::copy_constructible<ranges::range_value_t<R>>
+            GSTD_STATIC void operator()(R && rng, Comp comp = {}) GSTD_CONST
+            {
+                sort_fn{}(thread_pool::global(), static_cast<R &&>(rng), std::move(comp));
+            }
+        };
+
+        // stable, see `ranges::radix_sort`, `alloc` provides a buffer as large as `rng` and, for small ranges, the
+        // histograms (on the calling thread)
+        struct radix_sort_fn {
+            template<typename R, typename Alloc, typename Proj = std::identity>
+            requires allocation::allocator<std::remove_cvref_t<Alloc>> && ranges::_impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(thread_pool & pool, R && rng, Alloc && alloc, Proj proj = {}) GSTD_CONST
+            {
+                radix_sort(pool, ranges::data(rng), _impl::size(rng), alloc, proj);
+            }
+
+            template<typename R, typename Proj = std::identity>
+            requires ranges::_impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(thread_pool & pool, R && rng, Proj proj = {}) GSTD_CONST
+            {
+                radix_sort_fn{}(pool, static_cast<R &&>(rng), allocation::c_allocator, std::move(proj));
+            }
+
+            template<typename R, typename Alloc, typename Proj = std::identity>
+            requires allocation::allocator<std::remove_cvref_t<Alloc>> && ranges::_impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(R && rng, Alloc && alloc, Proj proj = {}) GSTD_CONST
+            {
+                radix_sort_fn{}(thread_pool::global(), static_cast<R &&>(rng), alloc, std::move(proj));
+            }
+
+            template<typename R, typename Proj = std::identity>
+            requires ranges::_impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(R && rng, Proj proj = {}) GSTD_CONST
+            {
+                radix_sort_fn{}(thread_pool::global(), static_cast<R &&>(rng), std::move(proj));
+            }
+        };
+    }
+
+    inline constexpr _impl::algorithm::for_each_fn for_each;
+    inline constexpr _impl::algorithm::transform_reduce_fn transform_reduce;
+    inline constexpr _impl::algorithm::inclusive_scan_fn inclusive_scan;
+    inline constexpr _impl::algorithm::partition_fn partition;
+    inline constexpr _impl::algorithm::sort_fn sort;
+    inline constexpr _impl::algorithm::radix_sort_fn radix_sort;
+}
+
+#endif
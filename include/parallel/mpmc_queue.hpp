@@ -0,0 +1,188 @@
+#ifndef GSTD_PARALLEL_MPMC_QUEUE_HPP
+#define GSTD_PARALLEL_MPMC_QUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include "allocation/c_allocator.hpp"
+#include "parallel/ring_buffer.hpp"
+
+// Bounded multi-producer multi-consumer queue (Vyukov): every slot carries a sequence number telling producers and
+// consumers whose turn it is, so a push or pop is a single CAS on the shared position followed by a release store to
+// the slot. Batches claim a run of slots with one CAS.
+// Never blocks except that a batch may briefly wait for a slot whose previous occupant is still being moved out (or
+// in) by another thread which already claimed it.
+
+namespace gstd::parallel {
+    template<typename T, allocation::allocator Alloc = allocation::c_allocator_type>
+    class mpmc_queue {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>);
+
+        struct slot {
+            std::atomic<size_t> sequence{0};
+            alignas(T) std::byte value[sizeof(T)];
+
+            [[nodiscard]] T & get() noexcept { return *std::launder(reinterpret_cast<T *>(value)); }
+        };
+      public:
+        // room for `capacity` (rounded up to a power of two) elements
+        explicit mpmc_queue(size_t capacity)
+        requires allocation::stateless_allocator<Alloc>
+            : _slots{capacity, nullptr}
+        {
+            init();
+        }
+
+        mpmc_queue(size_t capacity, Alloc & alloc)
+        requires (!allocation::stateless_allocator<Alloc>)
+            : _slots{capacity, std::addressof(alloc)}
+        {
+            init();
+        }
+
+        mpmc_queue(mpmc_queue const &)             = delete;
+        mpmc_queue & operator=(mpmc_queue const &) = delete;
+
+        ~mpmc_queue()
+        {
+            while(try_pop()) {}
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept { return _slots.capacity(); }
+
+        // `false` if the queue is full
+        template<typename... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+        [[nodiscard]] bool try_emplace(Args &&... args) noexcept
+        {
+            auto pos = _tail.load(std::memory_order_relaxed);
+            for(;;) {
+                auto & s   = _slots[pos];
+                auto ready = static_cast<std::ptrdiff_t>(s.sequence.load(std::memory_order_acquire) - pos);
+                if(ready == 0) {
+                    if(_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        ::new(s.value) T(static_cast<Args &&>(args)...);
+                        s.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                } else if(ready < 0) {
+                    return false;
+                } else {
+                    pos = _tail.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] bool try_push(T const & value) noexcept
+        requires std::is_nothrow_copy_constructible_v<T>
+        {
+            return try_emplace(value);
+        }
+
+        [[nodiscard]] bool try_push(T && value) noexcept { return try_emplace(std::move(value)); }
+
+        // `std::nullopt` if the queue is empty
+        [[nodiscard]] std::optional<T> try_pop() noexcept
+        {
+            auto pos = _head.load(std::memory_order_relaxed);
+            for(;;) {
+                auto & s   = _slots[pos];
+                auto ready = static_cast<std::ptrdiff_t>(s.sequence.load(std::memory_order_acquire) - (pos + 1));
+                if(ready == 0) {
+                    if(_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        return take(s, pos);
+                } else if(ready < 0) {
+                    return std::nullopt;
+                } else {
+                    pos = _head.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // moves up to `n` elements from `first` into the queue, returns how many
+        template<typename It>
+        [[nodiscard]] size_t try_push_n(It first, size_t n) noexcept
+        {
+            size_t pos;
+            auto k = claim(_tail, 0, n, pos);
+            for(size_t i = 0; i < k; ++i, ++first) {
+                auto & s = _slots[pos + i];
+                wait(s, pos + i);
+                ::new(s.value) T(std::move(*first));
+                s.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            return k;
+        }
+
+        // moves up to `n` elements out of the queue into `out`, returns how many
+        template<typename It>
+        [[nodiscard]] size_t try_pop_n(It out, size_t n) noexcept
+        {
+            size_t pos;
+            auto k = claim(_head, 1, n, pos);
+            for(size_t i = 0; i < k; ++i, ++out) {
+                auto & s = _slots[pos + i];
+                wait(s, pos + i + 1);
+                *out = take(s, pos + i);
+            }
+            return k;
+        }
+      private:
+        void init() noexcept
+        {
+            for(size_t i = 0; i < _slots.capacity(); ++i)
+                _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] T take(slot & s, size_t pos) noexcept
+        {
+            T value = std::move(s.get());
+            std::destroy_at(std::addressof(s.get()));
+            s.sequence.store(pos + capacity(), std::memory_order_release);
+            return value;
+        }
+
+        // the thread owning the slot may have been preempted, so this eventually yields
+        static void wait(slot & s, size_t sequence) noexcept
+        {
+            for(int spin = 0; s.sequence.load(std::memory_order_acquire) != sequence; ++spin)
+                if(spin >= 64)
+                    std::this_thread::yield();
+        }
+
+        // claims up to `n` positions of `position` whose slots are at `pos + offset`, halving the batch while its last
+        // slot isn't ready yet (earlier slots are, or are about to be)
+        [[nodiscard]] size_t claim(std::atomic<size_t> & position, size_t offset, size_t n, size_t & pos) noexcept
+        {
+            n   = std::min(n, capacity());
+            pos = position.load(std::memory_order_relaxed);
+            for(auto k = n; k;) {
+                auto last  = pos + k - 1;
+                auto ready = static_cast<std::ptrdiff_t>(_slots[last].sequence.load(std::memory_order_acquire)
+                                                        - (last + offset));
+                if(ready == 0) {
+                    if(position.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed))
+                        return k;
+                    k = n;
+                } else if(ready < 0) {
+                    k /= 2;
+                } else {
+                    pos = position.load(std::memory_order_relaxed);
+                    k   = n;
+                }
+            }
+            return 0;
+        }
+
+        _impl::ring_buffer<slot, Alloc> _slots;
+        // next position to push to/pop from
+        alignas(_impl::cache_line) std::atomic<size_t> _tail{0};
+        alignas(_impl::cache_line) std::atomic<size_t> _head{0};
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef GSTD_PARALLEL_RING_BUFFER_HPP
+#define GSTD_PARALLEL_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/aligned.hpp"
+#include "allocation/base.hpp"
+
+namespace gstd::parallel {
+    using size_t = decltype(sizeof(nullptr));
+
+    namespace _impl {
+        // separates data written by different threads
+        inline constexpr size_t cache_line = 64;
+
+        // cache-line aligned array of a power-of-two number of default-constructed `T`s from `Alloc`
+        // stateless allocators are held by value, any other `Alloc` is referred to and has to outlive the buffer
+        template<typename T, allocation::allocator Alloc>
+        class ring_buffer {
+            static constexpr bool stateless = allocation::stateless_allocator<Alloc>;
+          public:
+            // throws `std::bad_alloc` if the memory can't be allocated
+            ring_buffer(size_t capacity, Alloc * alloc) : _alloc{}
+            {
+                if constexpr(!stateless)
+                    _alloc = alloc;
+                if(capacity > std::numeric_limits<size_t>::max() / 2 / sizeof(T))
+                    throw std::bad_array_new_length{};
+                _capacity      = std::bit_ceil(std::max(capacity, size_t{2}));
+                auto alignment = std::max(alignof(T), cache_line);
+                auto slots     = allocation::allocate_aligned(get(), _capacity * sizeof(T), alignment);
+                if(!slots)
+                    throw std::bad_alloc{};
+                _allocation = slots.allocation;
+                _data       = static_cast<T *>(slots.ptr);
+                std::uninitialized_value_construct_n(_data, _capacity);
+            }
+
+            ring_buffer(ring_buffer const &)             = delete;
+            ring_buffer & operator=(ring_buffer const &) = delete;
+
+            ~ring_buffer()
+            {
+                std::destroy_n(_data, _capacity);
+                get().deallocate(_allocation);
+            }
+
+            [[nodiscard]] size_t capacity() const noexcept { return _capacity; }
+
+            // wraps around
+            [[nodiscard]] T & operator[](size_t i) const noexcept { return _data[i & (_capacity - 1)]; }
+          private:
+            [[nodiscard]] Alloc & get() noexcept
+            {
+                if constexpr(stateless)
+                    return _alloc;
+                else
+                    return *_alloc;
+            }
+
+            [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc;
+            allocation::allocation_result _allocation;
+            T * _data;
+            size_t _capacity;
+        };
+    }
+}
+
+#endif
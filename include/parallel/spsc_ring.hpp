@@ -0,0 +1,143 @@
+#ifndef GSTD_PARALLEL_SPSC_RING_HPP
+#define GSTD_PARALLEL_SPSC_RING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include "allocation/c_allocator.hpp"
+#include "parallel/ring_buffer.hpp"
+
+// Bounded single-producer single-consumer queue: the producer only writes the tail and the consumer only the head,
+// each on its own cache line next to a cached copy of the other one, so the shared line is only read once the cached
+// copy says the ring is full/empty (or too full/empty for a whole batch). Batches publish many elements with a single
+// store.
+
+namespace gstd::parallel {
+    template<typename T, allocation::allocator Alloc = allocation::c_allocator_type>
+    class spsc_ring {
+        static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>);
+
+        struct slot {
+            alignas(T) std::byte value[sizeof(T)];
+
+            [[nodiscard]] T & get() noexcept { return *std::launder(reinterpret_cast<T *>(value)); }
+        };
+      public:
+        // room for `capacity` (rounded up to a power of two) elements
+        explicit spsc_ring(size_t capacity)
+        requires allocation::stateless_allocator<Alloc>
+            : _slots{capacity, nullptr}
+        {}
+
+        spsc_ring(size_t capacity, Alloc & alloc)
+        requires (!allocation::stateless_allocator<Alloc>)
+            : _slots{capacity, std::addressof(alloc)}
+        {}
+
+        spsc_ring(spsc_ring const &)             = delete;
+        spsc_ring & operator=(spsc_ring const &) = delete;
+
+        ~spsc_ring()
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            for(auto head = _head.load(std::memory_order_relaxed); head != tail; ++head)
+                std::destroy_at(std::addressof(_slots[head].get()));
+        }
+
+        [[nodiscard]] size_t capacity() const noexcept { return _slots.capacity(); }
+
+        // producer only, `false` if the ring is full
+        template<typename... Args>
+        requires std::is_nothrow_constructible_v<T, Args...>
+        [[nodiscard]] bool try_emplace(Args &&... args) noexcept
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            if(!free(tail))
+                return false;
+            ::new(_slots[tail].value) T(static_cast<Args &&>(args)...);
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        [[nodiscard]] bool try_push(T const & value) noexcept
+        requires std::is_nothrow_copy_constructible_v<T>
+        {
+            return try_emplace(value);
+        }
+
+        [[nodiscard]] bool try_push(T && value) noexcept { return try_emplace(std::move(value)); }
+
+        // consumer only, `std::nullopt` if the ring is empty
+        [[nodiscard]] std::optional<T> try_pop() noexcept
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+            if(!used(head))
+                return std::nullopt;
+            std::optional<T> value{take(head)};
+            _head.store(head + 1, std::memory_order_release);
+            return value;
+        }
+
+        // producer only, moves up to `n` elements from `first` into the ring, returns how many
+        template<typename It>
+        [[nodiscard]] size_t try_push_n(It first, size_t n) noexcept
+        {
+            auto tail = _tail.load(std::memory_order_relaxed);
+            auto k    = std::min(n, free(tail, n));
+            for(size_t i = 0; i < k; ++i, ++first)
+                ::new(_slots[tail + i].value) T(std::move(*first));
+            _tail.store(tail + k, std::memory_order_release);
+            return k;
+        }
+
+        // consumer only, moves up to `n` elements out of the ring into `out`, returns how many
+        template<typename It>
+        [[nodiscard]] size_t try_pop_n(It out, size_t n) noexcept
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+            auto k    = std::min(n, used(head, n));
+            for(size_t i = 0; i < k; ++i, ++out)
+                *out = take(head + i);
+            _head.store(head + k, std::memory_order_release);
+            return k;
+        }
+      private:
+        // number of free slots, only rereads the head if the cached one says there are fewer than `wanted`
+        [[nodiscard]] size_t free(size_t tail, size_t wanted = 1) noexcept
+        {
+            if(capacity() - (tail - _head_cache) < wanted)
+                _head_cache = _head.load(std::memory_order_acquire);
+            return capacity() - (tail - _head_cache);
+        }
+
+        // number of elements, only rereads the tail if the cached one says there are fewer than `wanted`
+        [[nodiscard]] size_t used(size_t head, size_t wanted = 1) noexcept
+        {
+            if(_tail_cache - head < wanted)
+                _tail_cache = _tail.load(std::memory_order_acquire);
+            return _tail_cache - head;
+        }
+
+        [[nodiscard]] T take(size_t pos) noexcept
+        {
+            auto & value = _slots[pos].get();
+            T result     = std::move(value);
+            std::destroy_at(std::addressof(value));
+            return result;
+        }
+
+        _impl::ring_buffer<slot, Alloc> _slots;
+        // written by the producer
+        alignas(_impl::cache_line) std::atomic<size_t> _tail{0};
+        size_t _head_cache = 0;
+        // written by the consumer
+        alignas(_impl::cache_line) std::atomic<size_t> _head{0};
+        size_t _tail_cache = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,130 @@
+#ifndef GSTD_PARALLEL_THREAD_POOL_HPP
+#define GSTD_PARALLEL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include "allocation/arena_allocator.hpp"
+#include "allocation/c_allocator.hpp"
+#include "allocation/fallback_allocator.hpp"
+
+// Fork-join thread pool: every worker owns a Chase-Lev deque, `join` pushes its second half onto the calling
+// worker's deque and idle workers steal from the other end (see src/thread_pool.cpp).
+
+namespace gstd::parallel {
+    using size_t = decltype(sizeof(nullptr));
+
+    // per-worker bump allocator, falls back to `std::malloc` once the arena is exhausted
+    // space is only reclaimed if released in reverse order of allocation (like a stack)
+    using scratch_allocator = allocation::fallback_allocator<
+      allocation::arena_allocator<allocation::c_allocator_type>,
+      allocation::c_allocator_type>;
+
+    namespace _impl {
+        struct task {
+            explicit task(void (*execute)(task &) noexcept) noexcept : execute{execute} {}
+
+            void (*execute)(task &) noexcept;
+            std::atomic<bool> done{false};
+        };
+
+        template<typename F>
+        struct closure_task : task {
+            explicit closure_task(F & fn) noexcept : task{&invoke}, fn{std::addressof(fn)} {}
+
+            static void invoke(task & self) noexcept
+            {
+                auto & t = static_cast<closure_task &>(self);
+                try {
+                    (*t.fn)();
+                } catch(...) {
+                    t.error = std::current_exception();
+                }
+            }
+
+            F * fn;
+            std::exception_ptr error;
+        };
+    }
+
+    class thread_pool {
+      public:
+        // `threads == 0` uses `std::thread::hardware_concurrency()`
+        explicit thread_pool(size_t threads = 0, allocation::arena_size scratch_size = allocation::arena_size{1 << 20});
+        thread_pool(thread_pool const &)             = delete;
+        thread_pool & operator=(thread_pool const &) = delete;
+        // tasks still running are waited for
+        ~thread_pool();
+
+        // process-wide pool with `std::thread::hardware_concurrency()` workers
+        [[nodiscard]] static thread_pool & global();
+
+        // number of workers
+        [[nodiscard]] size_t size() const noexcept;
+
+        // calls `fn()` on a worker and waits for it, exceptions are rethrown
+        // runs `fn()` directly if the calling thread is one of this pool's workers
+        template<typename F>
+        void run(F && fn)
+        {
+            if(on_worker()) {
+                fn();
+                return;
+            }
+            _impl::closure_task<std::remove_reference_t<F>> t{fn};
+            submit(t);
+            if(t.error)
+                std::rethrow_exception(t.error);
+        }
+
+        // calls `f()` and `g()`, potentially in parallel, and returns once both have finished
+        // if either throws, the exception is rethrown after both have finished (`f`'s takes precedence)
+        template<typename F, typename G>
+        void join(F && f, G && g)
+        {
+            if(!on_worker()) {
+                run([&] { join(f, g); });
+                return;
+            }
+            _impl::closure_task<std::remove_reference_t<G>> right{g};
+            push(right);
+            std::exception_ptr error;
+            try {
+                f();
+            } catch(...) {
+                error = std::current_exception();
+            }
+            if(pop(right))
+                right.execute(right);
+            else
+                wait(right);
+            if(!error)
+                error = right.error;
+            if(error)
+                std::rethrow_exception(error);
+        }
+
+        // true if the calling worker's deque is empty ie. every task it forked has been stolen
+        // used to split work lazily: only fork more if someone took the previous piece
+        [[nodiscard]] bool starving() const noexcept;
+
+        // scratch memory of the calling worker, mustn't be used outside of `run`/`join`
+        [[nodiscard]] scratch_allocator & scratch() noexcept;
+      private:
+        struct state;
+
+        [[nodiscard]] bool on_worker() const noexcept;
+        void push(_impl::task & t);
+        // pops `t` off the calling worker's deque unless it has been stolen
+        [[nodiscard]] bool pop(_impl::task & t) noexcept;
+        // executes other tasks until `t` is done
+        void wait(_impl::task & t) noexcept;
+        // hands `t` to the workers and blocks until it's done
+        void submit(_impl::task & t);
+
+        std::unique_ptr<state> _state;
+    };
+}
+
+#endif
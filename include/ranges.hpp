@@ -2,6 +2,12 @@
 #define GSTD_RANGES_HPP
 
 #include "ranges/access.hpp"
+#include "ranges/algorithm.hpp"
 #include "ranges/base.hpp"
+#include "ranges/concepts.hpp"
+#include "ranges/radix_sort.hpp"
+#include "ranges/split.hpp"
+#include "ranges/to.hpp"
+#include "ranges/views.hpp"
 
 #endif
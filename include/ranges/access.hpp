@@ -2,6 +2,8 @@
 #define GSTD_RANGES_ACCESS_HPP
 
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include "ranges/base.hpp"
 #include "utility/static_const.hpp"
 #include "utility/triple.hpp"
@@ -126,9 +128,12 @@ namespace gstd::ranges {
         concept member_size_type = !adl_size<T> && member_size<T>;
         template<typename T>
         concept adl_size_type = adl_size<T>;
+        // only where the distance is O(1), walking the range isn't a size
         template<typename T>
         concept access_size_type = !adl_size<T> && !member_size<T> && requires(T t) {
-            std::distance(access::begin_fn{}(static_cast<T &&>(t)), access::end_fn{}(static_cast<T &&>(t)));
+            requires std::sized_sentinel_for<
+              decltype(access::end_fn{}(static_cast<T &&>(t))),
+              decltype(access::begin_fn{}(static_cast<T &&>(t)))>;
         };
 
         struct size_fn {
@@ -142,10 +147,9 @@ namespace gstd::ranges {
 
             template<access_size_type Range>
             [[nodiscard]] GSTD_STATIC constexpr auto operator()(Range && rng) GSTD_CONST //
-              GSTD_TRIPLE(std::distance(
-                access::begin_fn{}(static_cast<Range &&>(rng)),
-                access::end_fn{}(static_cast<Range &&>(rng))
-              ));
+              GSTD_TRIPLE(
+                access::end_fn{}(static_cast<Range &&>(rng)) - access::begin_fn{}(static_cast<Range &&>(rng))
+              );
         };
     }
 
@@ -185,12 +189,44 @@ namespace gstd::ranges {
         };
     }
 
+    namespace _impl::data {
+        template<typename T>
+        concept pointer_to_object = std::is_pointer_v<T> && std::is_object_v<std::remove_pointer_t<T>>;
+
+        template<typename T>
+        concept member_data = requires(T t) {
+            { static_cast<T &&>(t).data() } -> pointer_to_object;
+        };
+        template<typename T>
+        concept access_type = !member_data<T> && requires(T t) {
+            { access::begin_fn{}(static_cast<T &&>(t)) } -> std::contiguous_iterator;
+        };
+
+        struct data_fn {
+            template<member_data Range>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(Range && rng) GSTD_CONST
+              GSTD_TRIPLE(static_cast<Range &&>(rng).data());
+
+            template<access_type Range>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(Range && rng) GSTD_CONST
+              GSTD_TRIPLE(std::to_address(access::begin_fn{}(static_cast<Range &&>(rng))));
+        };
+
+        struct cdata_fn {
+            template<typename Range>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(Range && rng) GSTD_CONST
+              GSTD_TRIPLE(data_fn{}(static_cast<std::remove_reference_t<Range> const &>(rng)));
+        };
+    }
+
     inline constexpr _impl::access::begin_fn begin;
     inline constexpr _impl::access::end_fn end;
     inline constexpr _impl::raccess::rbegin_fn rbegin;
     inline constexpr _impl::raccess::rend_fn rend;
     inline constexpr _impl::size::size_fn size;
     inline constexpr _impl::empty::empty_fn empty;
+    inline constexpr _impl::data::data_fn data;
+    inline constexpr _impl::data::cdata_fn cdata;
 }
 
 #endif
@@ -0,0 +1,226 @@
+#ifndef GSTD_RANGES_ALGORITHM_HPP
+#define GSTD_RANGES_ALGORITHM_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "ranges/access.hpp"
+#include "ranges/base.hpp"
+#include "ranges/concepts.hpp"
+#include "utility/static_const.hpp"
+
+// Contiguous ranges of arithmetic types are processed by SSE2/AVX2 kernels (selected at runtime, see
+// src/simd_algorithm.cpp), everything else (including constant evaluation) uses the generic scalar loops.
+
+namespace gstd::ranges {
+    namespace _impl::simd {
+        template<size_t Size>
+        using unsigned_of_size = std::conditional_t<
+          Size == 1,
+          std::uint8_t,
+          std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+
+        template<typename T>
+        concept equality_mappable
+          = (std::is_integral_v<T> && sizeof(T) <= 8) || std::same_as<T, float> || std::same_as<T, double>;
+
+        // integers compare equal iff their representations do, floating point doesn't (+0.0 == -0.0, NaN != NaN)
+        template<equality_mappable T>
+        using equality_t = std::conditional_t<std::is_integral_v<T>, unsigned_of_size<sizeof(T)>, T>;
+
+        template<typename T>
+        concept order_mappable = std::is_integral_v<T> && !std::same_as<T, bool> && sizeof(T) <= 8;
+
+        template<order_mappable T>
+        using order_t = std::conditional_t<
+          std::is_signed_v<T>,
+          std::make_signed_t<unsigned_of_size<sizeof(T)>>,
+          unsigned_of_size<sizeof(T)>>;
+
+        // index of the first element equal to `value` or `size`
+        template<typename T>
+        [[nodiscard]] size_t find(T const * data, size_t size, T value) noexcept;
+
+        template<typename T>
+        [[nodiscard]] size_t count(T const * data, size_t size, T value) noexcept;
+
+        // index of the first `i` with `!(a[i] == b[i])` or `size`
+        template<typename T>
+        [[nodiscard]] size_t mismatch(T const * a, T const * b, size_t size) noexcept;
+
+        // `size` mustn't be 0
+        template<typename T>
+        [[nodiscard]] T min(T const * data, size_t size) noexcept;
+
+        template<typename T>
+        [[nodiscard]] T max(T const * data, size_t size) noexcept;
+
+#define GSTD_RANGES_SIMD_EQUALITY(T)                                          \
+    extern template size_t find<T>(T const *, size_t, T) noexcept;           \
+    extern template size_t count<T>(T const *, size_t, T) noexcept;          \
+    extern template size_t mismatch<T>(T const *, T const *, size_t) noexcept;
+#define GSTD_RANGES_SIMD_ORDER(T)                                \
+    extern template T min<T>(T const *, size_t) noexcept;       \
+    extern template T max<T>(T const *, size_t) noexcept;
+        GSTD_RANGES_SIMD_EQUALITY(std::uint8_t)
+        GSTD_RANGES_SIMD_EQUALITY(std::uint16_t)
+        GSTD_RANGES_SIMD_EQUALITY(std::uint32_t)
+        GSTD_RANGES_SIMD_EQUALITY(std::uint64_t)
+        GSTD_RANGES_SIMD_EQUALITY(float)
+        GSTD_RANGES_SIMD_EQUALITY(double)
+        GSTD_RANGES_SIMD_ORDER(std::int8_t)
+        GSTD_RANGES_SIMD_ORDER(std::uint8_t)
+        GSTD_RANGES_SIMD_ORDER(std::int16_t)
+        GSTD_RANGES_SIMD_ORDER(std::uint16_t)
+        GSTD_RANGES_SIMD_ORDER(std::int32_t)
+        GSTD_RANGES_SIMD_ORDER(std::uint32_t)
+        GSTD_RANGES_SIMD_ORDER(std::int64_t)
+        GSTD_RANGES_SIMD_ORDER(std::uint64_t)
+#undef GSTD_RANGES_SIMD_EQUALITY
+#undef GSTD_RANGES_SIMD_ORDER
+
+        template<typename R>
+        concept equality_range = contiguous_range<R> && equality_mappable<range_value_t<R>>;
+
+        template<typename R>
+        concept order_range = contiguous_range<R> && order_mappable<range_value_t<R>>;
+
+        // `std::in_range` rejects character types
+        template<typename T>
+        using standard_integer_t
+          = std::conditional_t<std::is_signed_v<T>, std::make_signed_t<T>, std::make_unsigned_t<T>>;
+
+        // `value` can be searched for in a range of `T` by comparing representations
+        template<typename T, typename U>
+        [[nodiscard]] constexpr bool representable(U const & value) noexcept
+        {
+            if constexpr(std::same_as<T, U>)
+                return true;
+            else if constexpr(order_mappable<T> && order_mappable<U>)
+                return std::in_range<standard_integer_t<T>>(static_cast<standard_integer_t<U>>(value));
+            else
+                return false;
+        }
+
+        template<typename R>
+        [[nodiscard]] auto pointer(R & rng) noexcept
+        {
+            return reinterpret_cast<equality_t<range_value_t<R>> const *>(ranges::data(rng));
+        }
+    }
+
+    namespace _impl::algorithm {
+        struct find_fn {
+            template<input_range R, typename T>
+            [[nodiscard]] GSTD_STATIC constexpr iterator_t<R> operator()(R && rng, T const & value) GSTD_CONST
+            {
+                if !consteval {
+                    if constexpr(simd::equality_range<R>) {
+                        using V = range_value_t<R>;
+                        if(simd::representable<V>(value)) {
+                            auto size   = static_cast<size_t>(ranges::size(rng));
+                            auto mapped = static_cast<simd::equality_t<V>>(static_cast<V>(value));
+                            return ranges::begin(rng) + simd::find(simd::pointer(rng), size, mapped);
+                        }
+                    }
+                }
+                auto it = ranges::begin(rng);
+                for(auto last = ranges::end(rng); it != last; ++it)
+                    if(*it == value)
+                        break;
+                return it;
+            }
+        };
+
+        struct count_fn {
+            template<input_range R, typename T>
+            [[nodiscard]] GSTD_STATIC constexpr size_t operator()(R && rng, T const & value) GSTD_CONST
+            {
+                if !consteval {
+                    if constexpr(simd::equality_range<R>) {
+                        using V = range_value_t<R>;
+                        if(simd::representable<V>(value)) {
+                            auto size   = static_cast<size_t>(ranges::size(rng));
+                            auto mapped = static_cast<simd::equality_t<V>>(static_cast<V>(value));
+                            return simd::count(simd::pointer(rng), size, mapped);
+                        }
+                    }
+                }
+                size_t n = 0;
+                for(auto it = ranges::begin(rng), last = ranges::end(rng); it != last; ++it)
+                    n += *it == value;
+                return n;
+            }
+        };
+
+        struct mismatch_fn {
+            template<input_range R1, input_range R2>
+            [[nodiscard]] GSTD_STATIC constexpr std::pair<iterator_t<R1>, iterator_t<R2>>
+            operator()(R1 && r1, R2 && r2) GSTD_CONST
+            {
+                if !consteval {
+                    if constexpr(simd::equality_range<R1> && simd::equality_range<R2>
+                                 && std::same_as<range_value_t<R1>, range_value_t<R2>>) {
+                        auto s1 = static_cast<size_t>(ranges::size(r1));
+                        auto s2 = static_cast<size_t>(ranges::size(r2));
+                        auto i  = simd::mismatch(simd::pointer(r1), simd::pointer(r2), s1 < s2 ? s1 : s2);
+                        return {ranges::begin(r1) + i, ranges::begin(r2) + i};
+                    }
+                }
+                auto it1 = ranges::begin(r1);
+                auto it2 = ranges::begin(r2);
+                for(auto last1 = ranges::end(r1), last2 = ranges::end(r2); it1 != last1 && it2 != last2; ++it1, ++it2)
+                    if(!(*it1 == *it2))
+                        break;
+                return {it1, it2};
+            }
+        };
+
+        struct equal_fn {
+            template<input_range R1, input_range R2>
+            [[nodiscard]] GSTD_STATIC constexpr bool operator()(R1 && r1, R2 && r2) GSTD_CONST
+            {
+                if constexpr(sized_range<R1> && sized_range<R2>)
+                    if(static_cast<size_t>(ranges::size(r1)) != static_cast<size_t>(ranges::size(r2)))
+                        return false;
+                auto [it1, it2] = mismatch_fn{}(r1, r2);
+                return it1 == ranges::end(r1) && it2 == ranges::end(r2);
+            }
+        };
+
+        // `rng` mustn't be empty
+        template<bool Max>
+        struct min_max_fn {
+            template<input_range R>
+            [[nodiscard]] GSTD_STATIC constexpr range_value_t<R> operator()(R && rng) GSTD_CONST
+            {
+                if !consteval {
+                    if constexpr(simd::order_range<R>) {
+                        using V = simd::order_t<range_value_t<R>>;
+                        auto data = reinterpret_cast<V const *>(ranges::data(rng));
+                        auto size = static_cast<size_t>(ranges::size(rng));
+                        return static_cast<range_value_t<R>>(Max ? simd::max(data, size) : simd::min(data, size));
+                    }
+                }
+                auto it     = ranges::begin(rng);
+                auto last   = ranges::end(rng);
+                auto result = static_cast<range_value_t<R>>(*it);
+                while(++it != last) {
+                    if(Max ? result < *it : *it < result)
+                        result = *it;
+                }
+                return result;
+            }
+        };
+    }
+
+    inline constexpr _impl::algorithm::find_fn find;
+    inline constexpr _impl::algorithm::count_fn count;
+    inline constexpr _impl::algorithm::mismatch_fn mismatch;
+    inline constexpr _impl::algorithm::equal_fn equal;
+    inline constexpr _impl::algorithm::min_max_fn<false> min;
+    inline constexpr _impl::algorithm::min_max_fn<true> max;
+}
+
+#endif
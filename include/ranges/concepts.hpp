@@ -0,0 +1,52 @@
+#ifndef GSTD_RANGES_CONCEPTS_HPP
+#define GSTD_RANGES_CONCEPTS_HPP
+
+#include <concepts>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "ranges/access.hpp"
+
+namespace gstd::ranges {
+    template<typename R>
+    concept range = requires(R & r) {
+        ranges::begin(r);
+        ranges::end(r);
+    };
+
+    template<range R>
+    using iterator_t = decltype(ranges::begin(std::declval<R &>()));
+
+    template<range R>
+    using sentinel_t = decltype(ranges::end(std::declval<R &>()));
+
+    template<range R>
+    using range_value_t = std::iter_value_t<iterator_t<R>>;
+
+    template<range R>
+    using range_reference_t = std::iter_reference_t<iterator_t<R>>;
+
+    // `ranges::size(r)` is O(1)
+    template<typename R>
+    concept sized_range = range<R> && requires(R & r) { ranges::size(r); };
+
+    template<typename R>
+    concept input_range = range<R> && std::input_iterator<iterator_t<R>>;
+
+    template<typename R>
+    concept forward_range = input_range<R> && std::forward_iterator<iterator_t<R>>;
+
+    template<typename R>
+    concept bidirectional_range = forward_range<R> && std::bidirectional_iterator<iterator_t<R>>;
+
+    template<typename R>
+    concept random_access_range = bidirectional_range<R> && std::random_access_iterator<iterator_t<R>>;
+
+    // elements are stored back to back in memory, starting at `ranges::data(r)`
+    template<typename R>
+    concept contiguous_range = random_access_range<R> && std::contiguous_iterator<iterator_t<R>> && requires(R & r) {
+        { ranges::data(r) } -> std::same_as<std::add_pointer_t<range_reference_t<R>>>;
+    };
+}
+
+#endif
@@ -0,0 +1,213 @@
+#ifndef GSTD_RANGES_RADIX_SORT_HPP
+#define GSTD_RANGES_RADIX_SORT_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+#include "ranges/access.hpp"
+#include "ranges/concepts.hpp"
+#include "utility/static_const.hpp"
+
+// `ranges::radix_sort(rng, [alloc], [proj])` stably sorts a contiguous range of trivially copyable elements by an
+// integer or floating-point key (`proj(element)`, the element itself by default) with a least-significant-digit radix
+// sort: one pass computes the histograms of all digits (11 bits for keys of 4 bytes and more, so 64-bit keys take 6
+// passes, 8 bits otherwise), then every digit that isn't the same for all keys scatters the elements into a buffer of
+// the same size and back. The histograms and the buffer come from `alloc` (`allocation::c_allocator` by default).
+// Signed integers are ordered by flipping the sign bit, IEEE floats by flipping all bits of negative values (so
+// -0.0 < +0.0 and NaNs sort to the ends according to their sign).
+
+namespace gstd::ranges {
+    namespace _impl::radix {
+        // insertion sort below this
+        inline constexpr size_t min_size = 64;
+
+        template<typename K>
+        concept key = (std::integral<K> && !std::same_as<K, bool>)
+                      || (std::floating_point<K> && std::numeric_limits<K>::is_iec559
+                          && (sizeof(K) == 4 || sizeof(K) == 8));
+
+        template<key K>
+        using unsigned_key_t = std::conditional_t<
+          std::integral<K>,
+          std::make_unsigned<K>,
+          std::conditional<sizeof(K) == 4, std::uint32_t, std::uint64_t>>::type;
+
+        // order-preserving mapping onto unsigned integers
+        template<key K>
+        [[nodiscard]] constexpr unsigned_key_t<K> encode(K k) noexcept
+        {
+            using U          = unsigned_key_t<K>;
+            constexpr U sign = U{1} << (std::numeric_limits<U>::digits - 1);
+            if constexpr(std::unsigned_integral<K>) {
+                return k;
+            } else if constexpr(std::signed_integral<K>) {
+                return static_cast<U>(static_cast<U>(k) ^ sign);
+            } else {
+                auto bits = std::bit_cast<U>(k);
+                return static_cast<U>(bits ^ ((bits & sign) ? static_cast<U>(~U{0}) : sign));
+            }
+        }
+
+        template<key K>
+        inline constexpr size_t digit_bits = sizeof(K) >= 4 ? 11 : 8;
+
+        template<key K>
+        inline constexpr size_t radix = size_t{1} << digit_bits<K>;
+
+        template<key K>
+        inline constexpr size_t passes = (sizeof(K) * 8 + digit_bits<K> - 1) / digit_bits<K>;
+
+        template<key K>
+        using histogram = size_t[radix<K>];
+
+        template<key K>
+        [[nodiscard]] constexpr size_t digit(unsigned_key_t<K> u, size_t pass) noexcept
+        {
+            return static_cast<size_t>(u >> (pass * digit_bits<K>)) & (radix<K> - 1);
+        }
+
+        template<typename T, typename Proj>
+        using key_t = std::remove_cvref_t<std::invoke_result_t<Proj &, T const &>>;
+
+        template<typename R, typename Proj>
+        concept sortable = contiguous_range<R> && sized_range<R> && std::is_trivially_copyable_v<range_value_t<R>>
+                           && !std::is_const_v<std::remove_reference_t<range_reference_t<R>>>
+                           && std::invocable<Proj &, range_value_t<R> const &>
+                           && key<key_t<range_value_t<R>, Proj>>;
+
+        // uninitialized storage for `size` elements, rounded up to `std::max_align_t` for bump allocators
+        template<typename T, typename Alloc>
+        class buffer {
+            static constexpr size_t alignment = alignof(std::max_align_t);
+            static_assert(alignof(T) <= alignment, "over-aligned types aren't supported");
+          public:
+            buffer(Alloc & alloc, size_t size) : _alloc{alloc}
+            {
+                if(size > std::numeric_limits<size_t>::max() / sizeof(T) - alignment)
+                    throw std::bad_array_new_length{};
+                _allocation = _alloc.allocate((size * sizeof(T) + alignment - 1) / alignment * alignment);
+                if(!_allocation)
+                    throw std::bad_alloc{};
+            }
+
+            buffer(buffer const &)             = delete;
+            buffer & operator=(buffer const &) = delete;
+
+            ~buffer() { _alloc.deallocate(_allocation); }
+
+            [[nodiscard]] T * data() const noexcept { return static_cast<T *>(_allocation.ptr); }
+          private:
+            Alloc & _alloc;
+            allocation::allocation_result _allocation;
+        };
+
+        // stable insertion sort by encoded key
+        template<typename T, typename Proj>
+        void insertion_sort(T * data, size_t size, Proj & proj)
+        {
+            using K = key_t<T, Proj>;
+            for(size_t i = 1; i < size; ++i) {
+                T value = data[i];
+                auto k  = encode<K>(std::invoke(proj, std::as_const(value)));
+                auto j  = i;
+                for(; j && k < encode<K>(std::invoke(proj, std::as_const(data[j - 1]))); --j)
+                    data[j] = data[j - 1];
+                data[j] = value;
+            }
+        }
+
+        // counts[pass][digit] over all digits of [data, data + size)
+        template<typename T, typename Proj>
+        void histograms(T const * data, size_t size, Proj & proj, histogram<key_t<T, Proj>> * counts) noexcept
+        {
+            using K = key_t<T, Proj>;
+            for(size_t i = 0; i < size; ++i) {
+                auto u = encode<K>(std::invoke(proj, data[i]));
+                for(size_t pass = 0; pass < passes<K>; ++pass)
+                    ++counts[pass][digit<K>(u, pass)];
+            }
+        }
+
+        // `offsets[d]` is where the first element with digit `d` goes, advanced while scattering
+        template<typename T, typename Proj>
+        void scatter(T const * from, size_t size, T * to, Proj & proj, size_t pass, size_t * offsets) noexcept
+        {
+            using K = key_t<T, Proj>;
+            for(size_t i = 0; i < size; ++i) {
+                auto d = digit<K>(encode<K>(std::invoke(proj, from[i])), pass);
+                std::memcpy(to + offsets[d]++, from + i, sizeof(T));
+            }
+        }
+
+        // every key has the same digit, the pass wouldn't change anything
+        template<key K>
+        [[nodiscard]] bool trivial(histogram<K> const & count, size_t size) noexcept
+        {
+            for(auto c : count)
+                if(c)
+                    return c == size;
+            return true;
+        }
+
+        template<typename T, typename Proj, typename Alloc>
+        void sort(T * data, size_t size, Alloc & alloc, Proj & proj)
+        {
+            if(size < min_size) {
+                insertion_sort(data, size, proj);
+                return;
+            }
+            using K = key_t<T, Proj>;
+            // up to 96 KiB, too large for the stack
+            buffer<histogram<K>, Alloc> counts{alloc, passes<K>};
+            std::memset(counts.data(), 0, passes<K> * sizeof(histogram<K>));
+            histograms(static_cast<T const *>(data), size, proj, counts.data());
+            buffer<T, Alloc> scratch{alloc, size};
+            T * from = data;
+            T * to   = scratch.data();
+            for(size_t pass = 0; pass < passes<K>; ++pass) {
+                auto & count = counts.data()[pass];
+                if(trivial<K>(count, size))
+                    continue;
+                // the pass's counts become its offsets
+                for(size_t d = 0, sum = 0; d < radix<K>; ++d)
+                    count[d] = std::exchange(sum, sum + count[d]);
+                scatter(static_cast<T const *>(from), size, to, proj, pass, count);
+                std::swap(from, to);
+            }
+            if(from != data)
+                std::memcpy(data, from, size * sizeof(T));
+        }
+    }
+
+    namespace _impl::algorithm {
+        struct radix_sort_fn {
+            template<typename R, typename Alloc, typename Proj = std::identity>
+            requires allocation::allocator<std::remove_cvref_t<Alloc>> && _impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(R && rng, Alloc && alloc, Proj proj = {}) GSTD_CONST
+            {
+                auto size = static_cast<size_t>(ranges::size(rng));
+                _impl::radix::sort(ranges::data(rng), size, alloc, proj);
+            }
+
+            template<typename R, typename Proj = std::identity>
+            requires _impl::radix::sortable<R, Proj>
+            GSTD_STATIC void operator()(R && rng, Proj proj = {}) GSTD_CONST
+            {
+                radix_sort_fn{}(static_cast<R &&>(rng), allocation::c_allocator, std::move(proj));
+            }
+        };
+    }
+
+    inline constexpr _impl::algorithm::radix_sort_fn radix_sort;
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef GSTD_RANGES_SPLIT_HPP
+#define GSTD_RANGES_SPLIT_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include "ranges/access.hpp"
+#include "ranges/algorithm.hpp"
+#include "ranges/concepts.hpp"
+#include "ranges/views.hpp"
+#include "utility/static_const.hpp"
+
+// `views::split(delim)` and `views::lines` over contiguous ranges of `char`, eg. an `io::mapped_file`.
+// Fields are `std::string_view`s into the underlying range, delimiters are searched for with the SIMD kernels.
+// Like `std::views::split`, "a,,b," splits into "a", "", "b" and "", `lines` doesn't yield the empty line after a
+// trailing '\n' (like `std::getline`). Neither yields anything for an empty range.
+
+namespace gstd::ranges {
+    namespace _impl::split {
+        template<typename R>
+        concept char_range = contiguous_range<R> && sized_range<R> && std::same_as<range_value_t<R>, char>;
+
+        // first `delim` in [first, last) or `last`
+        [[nodiscard]] constexpr char const * find(char const * first, char const * last, char delim) noexcept
+        {
+            if consteval {
+                return std::find(first, last, delim);
+            } else {
+                auto size = static_cast<size_t>(last - first);
+                auto * p  = reinterpret_cast<std::uint8_t const *>(first);
+                return first + simd::find(p, size, static_cast<std::uint8_t>(delim));
+            }
+        }
+    }
+
+    template<view V, bool Lines = false>
+    requires _impl::split::char_range<V>
+    class split_view : public view_base {
+      public:
+        class iterator {
+          public:
+            using iterator_concept = std::forward_iterator_tag;
+            using value_type       = std::string_view;
+            using difference_type  = std::ptrdiff_t;
+
+            iterator() = default;
+
+            constexpr iterator(char const * first, char const * last, char delim) noexcept
+                : _field{first}, _next{first == last ? last : _impl::split::find(first, last, delim)}, _last{last}
+                , _delim{delim}
+            {}
+
+            [[nodiscard]] constexpr std::string_view operator*() const noexcept
+            {
+                return {_field, static_cast<size_t>(_next - _field)};
+            }
+
+            constexpr iterator & operator++() noexcept
+            {
+                if(_next == _last) {
+                    _field    = _last;
+                    _trailing = false;
+                } else {
+                    _field = _next + 1;
+                    // a delimiter at the very end is followed by an empty field
+                    _trailing = _field == _last && !Lines;
+                    _next     = _impl::split::find(_field, _last, _delim);
+                }
+                return *this;
+            }
+
+            constexpr iterator operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs) noexcept
+            {
+                return lhs._field == rhs._field && lhs._trailing == rhs._trailing;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, std::default_sentinel_t) noexcept
+            {
+                return it._field == it._last && !it._trailing;
+            }
+          private:
+            char const * _field = nullptr;
+            char const * _next  = nullptr;
+            char const * _last  = nullptr;
+            char _delim{};
+            bool _trailing = false;
+        };
+
+        constexpr split_view(V base, char delim) : _base(std::move(base)), _delim{delim} {}
+
+        [[nodiscard]] constexpr iterator begin()
+        {
+            char const * first = ranges::data(_base);
+            return {first, first + ranges::size(_base), _delim};
+        }
+
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return {}; }
+      private:
+        V _base;
+        char _delim;
+    };
+
+    namespace _impl::split {
+        struct split_fn {
+            template<char_range R>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(R && rng, char delim) GSTD_CONST
+            {
+                return split_view<all_t<R>>{ranges::views::all(static_cast<R &&>(rng)), delim};
+            }
+
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(char delim) GSTD_CONST
+            {
+                return range_adaptor_closure{[delim]<char_range R>(R && rng) {
+                    return split_view<all_t<R>>{ranges::views::all(static_cast<R &&>(rng)), delim};
+                }};
+            }
+        };
+
+        struct lines_fn {
+            template<char_range R>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(R && rng) GSTD_CONST
+            {
+                return split_view<all_t<R>, true>{ranges::views::all(static_cast<R &&>(rng)), '\n'};
+            }
+        };
+    }
+
+    namespace views {
+        inline constexpr _impl::split::split_fn split;
+        inline constexpr range_adaptor_closure<_impl::split::lines_fn> lines;
+    }
+}
+
+#endif
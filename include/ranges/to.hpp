@@ -0,0 +1,152 @@
+#ifndef GSTD_RANGES_TO_HPP
+#define GSTD_RANGES_TO_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "allocation/base.hpp"
+#include "allocation/std_adapter.hpp"
+#include "ranges/access.hpp"
+#include "ranges/concepts.hpp"
+#include "ranges/views.hpp"
+
+// `ranges::to<Container>(rng, args...)` or `rng | ranges::to<Container>(args...)` collects `rng` into a new container
+// constructed from `args...`. A gstd allocator among `args...` is wrapped in `allocation::std_adapter` for containers
+// that expect a standard one, `to<std::vector>(rng, alloc)` deduces `std::vector<T, std_adapter<T, Alloc>>` (and
+// `to<std::set>(rng, alloc)` `std::set<T, std::less<T>, std_adapter<T, Alloc>>`).
+// Sized ranges cause a single reservation, contiguous ranges of trivially copyable elements are copied in bulk:
+// through the container's pointer-range constructor (a single allocation and memmove in the standard library) or by
+// resizing it once and `std::memcpy`-ing.
+
+namespace gstd::ranges {
+    namespace _impl::to {
+        template<typename C, typename Arg>
+        constexpr decltype(auto) forward_argument(Arg && arg)
+        {
+            using A = std::remove_cvref_t<Arg>;
+            if constexpr(allocation::allocator<A> && !std::constructible_from<C, Arg> && requires {
+                             typename C::allocator_type;
+                         })
+                return typename C::allocator_type(arg);
+            else
+                return static_cast<Arg &&>(arg);
+        }
+
+        template<typename C, typename T>
+        constexpr void append(C & c, T && value)
+        {
+            if constexpr(requires { c.emplace_back(static_cast<T &&>(value)); })
+                c.emplace_back(static_cast<T &&>(value));
+            else if constexpr(requires { c.push_back(static_cast<T &&>(value)); })
+                c.push_back(static_cast<T &&>(value));
+            else if constexpr(requires { c.emplace(static_cast<T &&>(value)); })
+                c.emplace(static_cast<T &&>(value));
+            else
+                c.insert(c.end(), static_cast<T &&>(value));
+        }
+
+        template<typename C, typename R>
+        concept bulk_source = contiguous_range<R> && sized_range<R> && requires { typename C::value_type; }
+                              && std::same_as<range_value_t<R>, typename C::value_type>
+                              && std::is_trivially_copyable_v<range_value_t<R>>;
+
+        template<typename C>
+        concept memcpy_target = requires(C & c, size_t n) {
+            c.resize(n);
+            { ranges::data(c) } -> std::same_as<typename C::value_type *>;
+        };
+
+        template<typename C, typename R, typename... Args>
+        constexpr C collect(R && rng, Args &&... args)
+        {
+            using pointer = range_value_t<R> const *;
+            if constexpr(bulk_source<C, R>) {
+                auto size = static_cast<size_t>(ranges::size(rng));
+                pointer first = ranges::data(rng);
+                if constexpr(std::constructible_from<C, pointer, pointer, decltype(forward_argument<C>(args))...>) {
+                    return C(first, first + size, forward_argument<C>(static_cast<Args &&>(args))...);
+                } else if constexpr(memcpy_target<C>) {
+                    C c(forward_argument<C>(static_cast<Args &&>(args))...);
+                    c.resize(size);
+                    if consteval {
+                        std::copy(first, first + size, ranges::data(c));
+                    } else {
+                        if(size)
+                            std::memcpy(ranges::data(c), first, size * sizeof(range_value_t<R>));
+                    }
+                    return c;
+                }
+            }
+            C c(forward_argument<C>(static_cast<Args &&>(args))...);
+            if constexpr(sized_range<R> && requires { c.reserve(size_t{}); })
+                c.reserve(static_cast<size_t>(ranges::size(rng)));
+            for(auto && value : rng)
+                append(c, static_cast<decltype(value) &&>(value));
+            return c;
+        }
+    }
+
+    template<typename C, range R, typename... Args>
+    requires (!view<C>)
+    [[nodiscard]] constexpr C to(R && rng, Args &&... args)
+    {
+        return _impl::to::collect<C>(static_cast<R &&>(rng), static_cast<Args &&>(args)...);
+    }
+
+    namespace _impl::to {
+        // `C` deduced from an iterator range of `T` (and an allocator), so the allocator ends up in its own parameter
+        // (after eg. `Compare` or `Hash`) and `value_type` may differ from `T` (eg. `std::pair<Key const, T>` for maps)
+        template<template<typename...> typename C, typename T, typename... Alloc>
+        using deduced = decltype(C(std::declval<T const *>(), std::declval<T const *>(), std::declval<Alloc>()...));
+
+        template<template<typename...> typename C, typename T, typename Alloc>
+        struct with_allocator {
+            using adapter = allocation::std_adapter<typename deduced<C, T>::value_type, Alloc>;
+
+            // the unordered containers only have deduction guides taking a bucket count before the allocator
+            using type = decltype([] {
+                if constexpr(requires { typename deduced<C, T, adapter>; })
+                    return std::type_identity<deduced<C, T, adapter>>{};
+                else
+                    return std::type_identity<deduced<C, T, size_t, adapter>>{};
+            }())::type;
+        };
+    }
+
+    // deduces the element type (and a `std_adapter` if a gstd allocator is passed)
+    template<template<typename...> typename C, range R, typename... Args>
+    [[nodiscard]] constexpr auto to(R && rng, Args &&... args)
+    {
+        using T = range_value_t<R>;
+        if constexpr(sizeof...(Args) == 1 && (allocation::allocator<std::remove_cvref_t<Args>> && ...))
+            return to<typename _impl::to::with_allocator<C, T, std::remove_cvref_t<Args>...>::type>(
+              static_cast<R &&>(rng), static_cast<Args &&>(args)...
+            );
+        else
+            return to<_impl::to::deduced<C, T>>(static_cast<R &&>(rng), static_cast<Args &&>(args)...);
+    }
+
+    // lvalue arguments (eg. allocators) are referred to, rvalues are stored
+    template<typename C, typename... Args>
+    requires (!view<C> && (!range<Args> && ...))
+    [[nodiscard]] constexpr auto to(Args &&... args)
+    {
+        return range_adaptor_closure{[args = std::tuple<Args...>(static_cast<Args &&>(args)...)]<range R>(R && rng) {
+            return std::apply([&](auto &... a) { return to<C>(static_cast<R &&>(rng), a...); }, args);
+        }};
+    }
+
+    template<template<typename...> typename C, typename... Args>
+    requires (!range<Args> && ...)
+    [[nodiscard]] constexpr auto to(Args &&... args)
+    {
+        return range_adaptor_closure{[args = std::tuple<Args...>(static_cast<Args &&>(args)...)]<range R>(R && rng) {
+            return std::apply([&](auto &... a) { return to<C>(static_cast<R &&>(rng), a...); }, args);
+        }};
+    }
+}
+
+#endif
@@ -0,0 +1,835 @@
+#ifndef GSTD_RANGES_VIEWS_HPP
+#define GSTD_RANGES_VIEWS_HPP
+
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "ranges/access.hpp"
+#include "ranges/base.hpp"
+#include "ranges/concepts.hpp"
+#include "utility/static_const.hpp"
+
+// Lazy views composable with `|`, eg. `vec | views::filter(odd) | views::transform(square) | views::take(10)`.
+// Iterators hold the underlying iterator and (at most) a pointer to their view, nothing is materialized.
+// Views refer to their parent from their iterators, so they mustn't be moved while being iterated.
+// Wherever the underlying range is random-access and sized, `take`/`drop` hand out the underlying iterators
+// themselves and `zip` compares a single iterator, so chains compile down to the loop one would have written by hand.
+
+namespace gstd::ranges {
+    struct view_base {};
+
+    template<typename V>
+    concept view = range<V> && std::movable<V> && std::derived_from<V, view_base>;
+
+    namespace _impl::views {
+        template<typename R>
+        concept common_range = range<R> && std::same_as<iterator_t<R>, sentinel_t<R>>;
+
+        template<typename R>
+        concept sized_random_access_range = random_access_range<R> && sized_range<R>;
+
+        template<typename R>
+        using difference_t = std::iter_difference_t<iterator_t<R>>;
+
+        template<typename R>
+        constexpr difference_t<R> ssize(R & rng) noexcept(noexcept(ranges::size(rng)))
+        {
+            return static_cast<difference_t<R>>(ranges::size(rng));
+        }
+
+        // the strongest standard iterator concept `It` models (up to random-access)
+        template<typename It>
+        using iterator_concept_t = std::conditional_t<
+          std::random_access_iterator<It>,
+          std::random_access_iterator_tag,
+          std::conditional_t<
+            std::bidirectional_iterator<It>,
+            std::bidirectional_iterator_tag,
+            std::conditional_t<std::forward_iterator<It>, std::forward_iterator_tag, std::input_iterator_tag>>>;
+
+        // a value computed on first use, copies and moves start out empty since it may point into its view
+        template<typename T>
+        class non_propagating_cache {
+          public:
+            non_propagating_cache() = default;
+
+            constexpr non_propagating_cache(non_propagating_cache const &) noexcept {}
+
+            constexpr non_propagating_cache & operator=(non_propagating_cache const & other) noexcept
+            {
+                if(this != &other)
+                    _value.reset();
+                return *this;
+            }
+
+            template<typename F>
+            [[nodiscard]] constexpr T & get(F && make)
+            {
+                if(!_value)
+                    _value.emplace(make());
+                return *_value;
+            }
+          private:
+            std::optional<T> _value;
+        };
+    }
+
+    template<range R>
+    class ref_view : public view_base {
+      public:
+        constexpr ref_view(R & rng) noexcept : _rng{std::addressof(rng)} {}
+
+        [[nodiscard]] constexpr iterator_t<R> begin() const { return ranges::begin(*_rng); }
+
+        [[nodiscard]] constexpr sentinel_t<R> end() const { return ranges::end(*_rng); }
+
+        [[nodiscard]] constexpr auto size() const
+        requires sized_range<R>
+        {
+            return ranges::size(*_rng);
+        }
+
+        [[nodiscard]] constexpr auto data() const
+        requires contiguous_range<R>
+        {
+            return ranges::data(*_rng);
+        }
+      private:
+        R * _rng;
+    };
+
+    template<range R>
+    requires std::movable<R>
+    class owning_view : public view_base {
+      public:
+        constexpr owning_view(R && rng) noexcept(std::is_nothrow_move_constructible_v<R>) : _rng(std::move(rng)) {}
+
+        [[nodiscard]] constexpr iterator_t<R> begin() { return ranges::begin(_rng); }
+
+        [[nodiscard]] constexpr sentinel_t<R> end() { return ranges::end(_rng); }
+
+        [[nodiscard]] constexpr auto size()
+        requires sized_range<R>
+        {
+            return ranges::size(_rng);
+        }
+
+        [[nodiscard]] constexpr auto data()
+        requires contiguous_range<R>
+        {
+            return ranges::data(_rng);
+        }
+      private:
+        R _rng;
+    };
+
+    // `closure(rng)` and `rng | closure` are equivalent, `rng | (c1 | c2)` is `rng | c1 | c2`
+    template<typename F>
+    struct range_adaptor_closure {
+        [[no_unique_address]] F fn;
+
+        template<range R>
+        constexpr auto operator()(R && rng) const
+        {
+            return fn(static_cast<R &&>(rng));
+        }
+    };
+
+    template<typename F>
+    range_adaptor_closure(F) -> range_adaptor_closure<F>;
+
+    template<range R, typename F>
+    constexpr auto operator|(R && rng, range_adaptor_closure<F> const & closure)
+    {
+        return closure(static_cast<R &&>(rng));
+    }
+
+    template<typename F, typename G>
+    constexpr auto operator|(range_adaptor_closure<F> first, range_adaptor_closure<G> second)
+    {
+        return range_adaptor_closure{[first = std::move(first), second = std::move(second)]<range R>(R && rng) {
+            return second(first(static_cast<R &&>(rng)));
+        }};
+    }
+
+    namespace _impl::views {
+        struct all_fn {
+            template<range R>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(R && rng) GSTD_CONST
+            {
+                if constexpr(view<std::decay_t<R>>)
+                    return std::decay_t<R>(static_cast<R &&>(rng));
+                else if constexpr(std::is_lvalue_reference_v<R>)
+                    return ref_view<std::remove_reference_t<R>>{rng};
+                else
+                    return owning_view<std::remove_cvref_t<R>>{std::move(rng)};
+            }
+        };
+    }
+
+    namespace views {
+        inline constexpr range_adaptor_closure<_impl::views::all_fn> all;
+    }
+
+    template<range R>
+    using all_t = decltype(views::all(std::declval<R>()));
+
+    template<view V, typename Pred>
+    class filter_view : public view_base {
+        class sentinel {
+          public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(sentinel_t<V> end) : _end(std::move(end)) {}
+
+            [[nodiscard]] constexpr sentinel_t<V> const & base() const noexcept { return _end; }
+          private:
+            sentinel_t<V> _end{};
+        };
+      public:
+        class iterator {
+          public:
+            using iterator_concept = std::conditional_t<
+              std::bidirectional_iterator<iterator_t<V>>,
+              std::forward_iterator_tag,
+              _impl::views::iterator_concept_t<iterator_t<V>>>;
+            using value_type      = range_value_t<V>;
+            using difference_type = _impl::views::difference_t<V>;
+
+            iterator() = default;
+
+            constexpr iterator(filter_view & parent, iterator_t<V> it) : _parent{&parent}, _it(std::move(it)) {}
+
+            [[nodiscard]] constexpr range_reference_t<V> operator*() const { return *_it; }
+
+            constexpr iterator & operator++()
+            {
+                _it = _parent->satisfy(++_it);
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                return lhs._it == rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, sentinel const & s)
+            {
+                return it._it == s.base();
+            }
+          private:
+            filter_view * _parent{};
+            iterator_t<V> _it{};
+        };
+
+        constexpr filter_view(V base, Pred pred) : _base(std::move(base)), _pred(std::move(pred)) {}
+
+        // the first match is only searched for once if it can be iterated to again
+        [[nodiscard]] constexpr iterator begin()
+        {
+            if constexpr(std::forward_iterator<iterator_t<V>>)
+                return {*this, _begin.get([this] { return satisfy(ranges::begin(_base)); })};
+            else
+                return {*this, satisfy(ranges::begin(_base))};
+        }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            if constexpr(_impl::views::common_range<V>)
+                return iterator{*this, ranges::end(_base)};
+            else
+                return sentinel{ranges::end(_base)};
+        }
+      private:
+        constexpr iterator_t<V> satisfy(iterator_t<V> it)
+        {
+            for(auto last = ranges::end(_base); it != last; ++it)
+                if(std::invoke(_pred, *it))
+                    break;
+            return it;
+        }
+
+        V _base;
+        [[no_unique_address]] Pred _pred;
+        _impl::views::non_propagating_cache<iterator_t<V>> _begin;
+    };
+
+    template<view V, typename F>
+    class transform_view : public view_base {
+        class sentinel {
+          public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(sentinel_t<V> end) : _end(std::move(end)) {}
+
+            [[nodiscard]] constexpr sentinel_t<V> const & base() const noexcept { return _end; }
+          private:
+            sentinel_t<V> _end{};
+        };
+      public:
+        class iterator {
+            using base_iterator = iterator_t<V>;
+          public:
+            using iterator_concept = _impl::views::iterator_concept_t<base_iterator>;
+            using value_type       = std::remove_cvref_t<std::invoke_result_t<F &, range_reference_t<V>>>;
+            using difference_type  = _impl::views::difference_t<V>;
+
+            iterator() = default;
+
+            constexpr iterator(transform_view & parent, base_iterator it) : _parent{&parent}, _it(std::move(it)) {}
+
+            [[nodiscard]] constexpr decltype(auto) operator*() const { return std::invoke(_parent->_fn, *_it); }
+
+            [[nodiscard]] constexpr decltype(auto) operator[](difference_type n) const
+            requires std::random_access_iterator<base_iterator>
+            {
+                return std::invoke(_parent->_fn, _it[n]);
+            }
+
+            constexpr iterator & operator++()
+            {
+                ++_it;
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++_it;
+                return copy;
+            }
+
+            constexpr iterator & operator--()
+            requires std::bidirectional_iterator<base_iterator>
+            {
+                --_it;
+                return *this;
+            }
+
+            constexpr iterator operator--(int)
+            requires std::bidirectional_iterator<base_iterator>
+            {
+                auto copy = *this;
+                --_it;
+                return copy;
+            }
+
+            constexpr iterator & operator+=(difference_type n)
+            requires std::random_access_iterator<base_iterator>
+            {
+                _it += n;
+                return *this;
+            }
+
+            constexpr iterator & operator-=(difference_type n)
+            requires std::random_access_iterator<base_iterator>
+            {
+                _it -= n;
+                return *this;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator+(iterator it, difference_type n)
+            requires std::random_access_iterator<base_iterator>
+            {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator+(difference_type n, iterator it)
+            requires std::random_access_iterator<base_iterator>
+            {
+                return it += n;
+            }
+
+            [[nodiscard]] friend constexpr iterator operator-(iterator it, difference_type n)
+            requires std::random_access_iterator<base_iterator>
+            {
+                return it -= n;
+            }
+
+            [[nodiscard]] friend constexpr difference_type operator-(iterator const & lhs, iterator const & rhs)
+            requires std::random_access_iterator<base_iterator>
+            {
+                return lhs._it - rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                return lhs._it == rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr auto operator<=>(iterator const & lhs, iterator const & rhs)
+            requires std::random_access_iterator<base_iterator>
+            {
+                return lhs._it <=> rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, sentinel const & s)
+            {
+                return it._it == s.base();
+            }
+          private:
+            transform_view * _parent{};
+            base_iterator _it{};
+        };
+
+        constexpr transform_view(V base, F fn) : _base(std::move(base)), _fn(std::move(fn)) {}
+
+        [[nodiscard]] constexpr iterator begin() { return {*this, ranges::begin(_base)}; }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            if constexpr(_impl::views::common_range<V>)
+                return iterator{*this, ranges::end(_base)};
+            else
+                return sentinel{ranges::end(_base)};
+        }
+
+        [[nodiscard]] constexpr auto size()
+        requires sized_range<V>
+        {
+            return ranges::size(_base);
+        }
+      private:
+        V _base;
+        [[no_unique_address]] F _fn;
+    };
+
+    template<view V>
+    class take_view : public view_base {
+        using difference_type = _impl::views::difference_t<V>;
+
+        // stops after `count` elements or at the end of the underlying range, whichever comes first
+        class iterator {
+          public:
+            using iterator_concept = std::conditional_t<
+              std::forward_iterator<iterator_t<V>>,
+              std::forward_iterator_tag,
+              std::input_iterator_tag>;
+            using value_type      = range_value_t<V>;
+            using difference_type = take_view::difference_type;
+
+            iterator() = default;
+
+            constexpr iterator(iterator_t<V> it, difference_type count) : _it(std::move(it)), _count{count} {}
+
+            [[nodiscard]] constexpr iterator_t<V> const & base() const noexcept { return _it; }
+
+            [[nodiscard]] constexpr difference_type count() const noexcept { return _count; }
+
+            [[nodiscard]] constexpr range_reference_t<V> operator*() const { return *_it; }
+
+            constexpr iterator & operator++()
+            {
+                ++_it;
+                --_count;
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                return lhs._count == rhs._count;
+            }
+          private:
+            iterator_t<V> _it{};
+            difference_type _count{};
+        };
+
+        class sentinel {
+          public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(sentinel_t<V> end) : _end(std::move(end)) {}
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, sentinel const & s)
+            {
+                return it.count() == 0 || it.base() == s._end;
+            }
+          private:
+            sentinel_t<V> _end{};
+        };
+      public:
+        constexpr take_view(V base, difference_type count) : _base(std::move(base)), _count{count} {}
+
+        [[nodiscard]] constexpr auto begin()
+        {
+            if constexpr(_impl::views::sized_random_access_range<V>)
+                return ranges::begin(_base);
+            else
+                return iterator{ranges::begin(_base), _count};
+        }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            if constexpr(_impl::views::sized_random_access_range<V>)
+                return ranges::begin(_base) + static_cast<difference_type>(size());
+            else
+                return sentinel{ranges::end(_base)};
+        }
+
+        [[nodiscard]] constexpr size_t size()
+        requires sized_range<V>
+        {
+            auto size = _impl::views::ssize(_base);
+            return static_cast<size_t>(size < _count ? size : _count);
+        }
+      private:
+        V _base;
+        difference_type _count;
+    };
+
+    template<view V>
+    class drop_view : public view_base {
+        using difference_type = _impl::views::difference_t<V>;
+      public:
+        constexpr drop_view(V base, difference_type count) : _base(std::move(base)), _count{count} {}
+
+        [[nodiscard]] constexpr iterator_t<V> begin()
+        {
+            if constexpr(_impl::views::sized_random_access_range<V>) {
+                auto size = _impl::views::ssize(_base);
+                return ranges::begin(_base) + (size < _count ? size : _count);
+            } else {
+                auto it = ranges::begin(_base);
+                for(auto [n, last] = std::pair{_count, ranges::end(_base)}; n > 0 && it != last; --n)
+                    ++it;
+                return it;
+            }
+        }
+
+        [[nodiscard]] constexpr sentinel_t<V> end() { return ranges::end(_base); }
+
+        [[nodiscard]] constexpr size_t size()
+        requires sized_range<V>
+        {
+            auto size = _impl::views::ssize(_base);
+            return static_cast<size_t>(size < _count ? 0 : size - _count);
+        }
+      private:
+        V _base;
+        difference_type _count;
+    };
+
+    template<view V>
+    class stride_view : public view_base {
+        using difference_type = _impl::views::difference_t<V>;
+      public:
+        class iterator {
+          public:
+            using iterator_concept = std::conditional_t<
+              std::forward_iterator<iterator_t<V>>,
+              std::forward_iterator_tag,
+              std::input_iterator_tag>;
+            using value_type      = range_value_t<V>;
+            using difference_type = stride_view::difference_type;
+
+            iterator() = default;
+
+            constexpr iterator(iterator_t<V> it, sentinel_t<V> end, difference_type step)
+                : _it(std::move(it)), _end(std::move(end)), _step{step}
+            {}
+
+            [[nodiscard]] constexpr range_reference_t<V> operator*() const { return *_it; }
+
+            constexpr iterator & operator++()
+            {
+                if constexpr(std::sized_sentinel_for<sentinel_t<V>, iterator_t<V>>) {
+                    auto remaining = _end - _it;
+                    _it           += remaining < _step ? remaining : _step;
+                } else {
+                    for(auto n = _step; n > 0 && _it != _end; --n)
+                        ++_it;
+                }
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                return lhs._it == rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, std::default_sentinel_t)
+            {
+                return it._it == it._end;
+            }
+          private:
+            iterator_t<V> _it{};
+            sentinel_t<V> _end{};
+            difference_type _step{};
+        };
+
+        // `step` must be positive
+        constexpr stride_view(V base, difference_type step) : _base(std::move(base)), _step{step} {}
+
+        [[nodiscard]] constexpr iterator begin() { return {ranges::begin(_base), ranges::end(_base), _step}; }
+
+        [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept { return {}; }
+
+        [[nodiscard]] constexpr size_t size()
+        requires sized_range<V>
+        {
+            return static_cast<size_t>((_impl::views::ssize(_base) + _step - 1) / _step);
+        }
+      private:
+        V _base;
+        difference_type _step;
+    };
+
+    template<view V>
+    class enumerate_view : public view_base {
+        using difference_type = _impl::views::difference_t<V>;
+        class sentinel {
+          public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(sentinel_t<V> end) : _end(std::move(end)) {}
+
+            [[nodiscard]] constexpr sentinel_t<V> const & base() const noexcept { return _end; }
+          private:
+            sentinel_t<V> _end{};
+        };
+      public:
+        class iterator {
+          public:
+            using iterator_concept = std::conditional_t<
+              std::forward_iterator<iterator_t<V>>,
+              std::forward_iterator_tag,
+              std::input_iterator_tag>;
+            using value_type      = std::pair<size_t, range_value_t<V>>;
+            using difference_type = enumerate_view::difference_type;
+
+            iterator() = default;
+
+            constexpr iterator(iterator_t<V> it, size_t index) : _it(std::move(it)), _index{index} {}
+
+            [[nodiscard]] constexpr std::pair<size_t, range_reference_t<V>> operator*() const
+            {
+                return {_index, *_it};
+            }
+
+            constexpr iterator & operator++()
+            {
+                ++_it;
+                ++_index;
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                return lhs._it == rhs._it;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, sentinel const & s)
+            {
+                return it._it == s.base();
+            }
+          private:
+            iterator_t<V> _it{};
+            size_t _index{};
+        };
+
+        constexpr explicit enumerate_view(V base) : _base(std::move(base)) {}
+
+        [[nodiscard]] constexpr iterator begin() { return {ranges::begin(_base), 0}; }
+
+        [[nodiscard]] constexpr sentinel end() { return sentinel{ranges::end(_base)}; }
+
+        [[nodiscard]] constexpr auto size()
+        requires sized_range<V>
+        {
+            return ranges::size(_base);
+        }
+      private:
+        V _base;
+    };
+
+    template<view... Vs>
+    requires (sizeof...(Vs) > 0)
+    class zip_view : public view_base {
+        // iterators advance in lockstep, so comparing the first one suffices if the end is computed up front
+        static constexpr bool lockstep = (_impl::views::sized_random_access_range<Vs> && ...);
+
+        using difference_type = std::common_type_t<_impl::views::difference_t<Vs>...>;
+        class sentinel {
+          public:
+            sentinel() = default;
+
+            constexpr explicit sentinel(std::tuple<sentinel_t<Vs>...> ends) : _ends(std::move(ends)) {}
+
+            [[nodiscard]] constexpr std::tuple<sentinel_t<Vs>...> const & base() const noexcept { return _ends; }
+          private:
+            std::tuple<sentinel_t<Vs>...> _ends{};
+        };
+      public:
+        class iterator {
+          public:
+            using iterator_concept = std::conditional_t<
+              (std::forward_iterator<iterator_t<Vs>> && ...),
+              std::forward_iterator_tag,
+              std::input_iterator_tag>;
+            using value_type      = std::tuple<range_value_t<Vs>...>;
+            using difference_type = zip_view::difference_type;
+
+            iterator() = default;
+
+            constexpr explicit iterator(std::tuple<iterator_t<Vs>...> its) : _its(std::move(its)) {}
+
+            [[nodiscard]] constexpr std::tuple<range_reference_t<Vs>...> operator*() const
+            {
+                return std::apply([](auto &... its) { return std::tuple<range_reference_t<Vs>...>(*its...); }, _its);
+            }
+
+            constexpr iterator & operator++()
+            {
+                std::apply([](auto &... its) { (++its, ...); }, _its);
+                return *this;
+            }
+
+            constexpr iterator operator++(int)
+            {
+                auto copy = *this;
+                ++*this;
+                return copy;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & lhs, iterator const & rhs)
+            {
+                if constexpr(lockstep)
+                    return std::get<0>(lhs._its) == std::get<0>(rhs._its);
+                else
+                    return lhs._its == rhs._its;
+            }
+
+            [[nodiscard]] friend constexpr bool operator==(iterator const & it, sentinel const & s)
+            {
+                return [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    return ((std::get<Is>(it._its) == std::get<Is>(s.base())) || ...);
+                }(std::index_sequence_for<Vs...>{});
+            }
+          private:
+            std::tuple<iterator_t<Vs>...> _its{};
+        };
+
+        constexpr explicit zip_view(Vs... bases) : _bases(std::move(bases)...) {}
+
+        [[nodiscard]] constexpr iterator begin()
+        {
+            return iterator{std::apply([](auto &... bases) { return std::tuple{ranges::begin(bases)...}; }, _bases)};
+        }
+
+        [[nodiscard]] constexpr auto end()
+        {
+            if constexpr(lockstep) {
+                auto n = static_cast<difference_type>(size());
+                return iterator{std::apply(
+                  [n](auto &... bases) { return std::tuple{ranges::begin(bases) + n...}; }, _bases
+                )};
+            } else {
+                return sentinel{std::apply([](auto &... bases) { return std::tuple{ranges::end(bases)...}; }, _bases)};
+            }
+        }
+
+        [[nodiscard]] constexpr size_t size()
+        requires (sized_range<Vs> && ...)
+        {
+            return std::apply(
+              [](auto &... bases) { return std::min({static_cast<size_t>(ranges::size(bases))...}); }, _bases
+            );
+        }
+      private:
+        std::tuple<Vs...> _bases;
+    };
+
+    namespace _impl::views {
+        // `adaptor(rng, args...)` or `rng | adaptor(args...)`
+        template<template<typename...> typename View>
+        struct adaptor {
+            template<range R, typename... Args>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(R && rng, Args... args) GSTD_CONST
+            {
+                return make(static_cast<R &&>(rng), std::move(args)...);
+            }
+
+            template<typename... Args>
+            requires (!range<Args> && ...)
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(Args... args) GSTD_CONST
+            {
+                return range_adaptor_closure{[... args = std::move(args)]<range R>(R && rng) {
+                    return make(static_cast<R &&>(rng), args...);
+                }};
+            }
+          private:
+            template<range R, typename... Args>
+            static constexpr auto make(R && rng, Args... args)
+            {
+                using V = all_t<R>;
+                if constexpr(requires { typename View<V, Args...>; })
+                    return View<V, Args...>(ranges::views::all(static_cast<R &&>(rng)), std::move(args)...);
+                else
+                    return View<V>(ranges::views::all(static_cast<R &&>(rng)), static_cast<difference_t<V>>(args)...);
+            }
+        };
+
+        struct enumerate_fn {
+            template<range R>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(R && rng) GSTD_CONST
+            {
+                return enumerate_view<all_t<R>>{ranges::views::all(static_cast<R &&>(rng))};
+            }
+        };
+
+        struct zip_fn {
+            template<range... Rs>
+            [[nodiscard]] GSTD_STATIC constexpr auto operator()(Rs &&... rngs) GSTD_CONST
+            {
+                return zip_view<all_t<Rs>...>{ranges::views::all(static_cast<Rs &&>(rngs))...};
+            }
+        };
+    }
+
+    namespace views {
+        inline constexpr _impl::views::adaptor<filter_view> filter;
+        inline constexpr _impl::views::adaptor<transform_view> transform;
+        inline constexpr _impl::views::adaptor<take_view> take;
+        inline constexpr _impl::views::adaptor<drop_view> drop;
+        inline constexpr _impl::views::adaptor<stride_view> stride;
+        inline constexpr range_adaptor_closure<_impl::views::enumerate_fn> enumerate;
+        inline constexpr _impl::views::zip_fn zip;
+    }
+}
+
+#endif
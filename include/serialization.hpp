@@ -0,0 +1,7 @@
+#ifndef GSTD_SERIALIZATION_HPP
+#define GSTD_SERIALIZATION_HPP
+
+#include "serialization/flat.hpp"
+#include "serialization/wire.hpp"
+
+#endif // GSTD_SERIALIZATION_HPP
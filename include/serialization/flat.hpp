@@ -0,0 +1,315 @@
+#ifndef GSTD_SERIALIZATION_FLAT_HPP
+#define GSTD_SERIALIZATION_FLAT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include "meta/type_sequence.hpp"
+#include "serialization/wire.hpp"
+
+// A schema is a `type_sequence` of `wire_type`s.
+// Its wire layout places every field at the next offset that satisfies its `wire_alignment` and pads the record to
+// a multiple of the largest alignment, so serialized records can be stored back to back.
+
+namespace gstd::serialization {
+    namespace _impl {
+        using meta::type_sequence::sequence_of_types;
+        using meta::type_sequence::type_sequence;
+
+        constexpr size_t align_up(size_t offset, size_t alignment) noexcept
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        template<typename T>
+        struct is_wire_type : std::bool_constant<wire_type<T>> {};
+
+        template<size_t I, typename T, size_t WireOffset, size_t NativeOffset>
+        struct field {
+            using type = T;
+
+            static constexpr size_t index         = I;
+            static constexpr size_t wire_offset   = WireOffset;
+            static constexpr size_t native_offset = NativeOffset;
+            static constexpr size_t wire_end      = WireOffset + sizeof(T);
+            static constexpr size_t native_end    = NativeOffset + sizeof(T);
+        };
+
+        template<typename Previous, size_t I, typename T>
+        using next_field = field<
+          I,
+          T,
+          align_up(Previous::wire_end, wire_alignment<T>),
+          align_up(Previous::native_end, alignof(T))>;
+
+        // projection for `Schema::enumerated::mapped` that places each field right after its predecessor
+        template<sequence_of_types Schema>
+        struct place {
+            template<typename Entry>
+            struct field_of {};
+
+            template<typename T>
+            struct field_of<type_sequence<std::integral_constant<size_t, 0>, T>>
+                : std::type_identity<field<0, T, 0, 0>> {};
+
+            template<size_t I, typename T>
+            requires (I > 0)
+            struct field_of<type_sequence<std::integral_constant<size_t, I>, T>>
+                : std::type_identity<
+                    next_field<typename field_of<typename Schema::enumerated::template get<I - 1>>::type, I, T>> {};
+        };
+
+        template<sequence_of_types Fields>
+        struct tables {};
+
+        template<typename... Fields>
+        struct tables<type_sequence<Fields...>> {
+            static constexpr std::array<size_t, sizeof...(Fields)> wire_offsets{Fields::wire_offset...};
+            static constexpr std::array<size_t, sizeof...(Fields)> native_offsets{Fields::native_offset...};
+            static constexpr std::array<size_t, sizeof...(Fields)> sizes{sizeof(typename Fields::type)...};
+            static constexpr std::array<bool, sizeof...(Fields)> verbatim{wire_verbatim<typename Fields::type>...};
+            static constexpr size_t alignment        = std::max({wire_alignment<typename Fields::type>...});
+            static constexpr size_t native_alignment = std::max({alignof(typename Fields::type)...});
+        };
+
+        // fields `[first, last)` are copied with a single `memcpy` if `verbatim`, otherwise `last == first + 1`
+        struct run {
+            size_t first;
+            size_t last;
+            bool verbatim;
+        };
+
+        template<typename Tables>
+        constexpr auto make_runs() noexcept
+        {
+            constexpr auto count = Tables::sizes.size();
+            std::pair<std::array<run, count>, size_t> result{};
+            auto & [runs, n] = result;
+            for(size_t i = 0; i < count; ++i) {
+                auto shift = [](size_t j) { return Tables::native_offsets[j] - Tables::wire_offsets[j]; };
+                if(n && runs[n - 1].verbatim && Tables::verbatim[i] && shift(runs[n - 1].first) == shift(i))
+                    runs[n - 1].last = i + 1;
+                else
+                    runs[n++] = {i, i + 1, Tables::verbatim[i]};
+            }
+            return result;
+        }
+    }
+
+    template<meta::type_sequence::sequence_of_types Schema>
+    requires (!Schema::empty && Schema::template all<_impl::is_wire_type>)
+    struct flat_layout {
+        using fields = Schema::enumerated::template mapped<_impl::place<Schema>::template field_of>;
+      private:
+        using tables = _impl::tables<fields>;
+
+        static constexpr auto _runs = _impl::make_runs<tables>();
+      public:
+        template<size_t I>
+        using type = Schema::template get<I>;
+
+        static constexpr size_t count            = Schema::size;
+        static constexpr size_t alignment        = tables::alignment;
+        static constexpr size_t size             = _impl::align_up(fields::template get<count - 1>::wire_end, alignment);
+        static constexpr size_t native_alignment = tables::native_alignment;
+        static constexpr size_t native_size
+          = _impl::align_up(fields::template get<count - 1>::native_end, native_alignment);
+
+        static constexpr auto offsets        = tables::wire_offsets;
+        static constexpr auto native_offsets = tables::native_offsets;
+
+        static constexpr size_t run_count = _runs.second;
+        static constexpr std::span<_impl::run const> runs{_runs.first.data(), run_count};
+
+        // true if the runs leave padding bytes on the wire that have to be zeroed explicitly
+        static constexpr bool sparse = [] {
+            size_t covered = 0;
+            for(auto [first, last, _] : runs)
+                covered += tables::wire_offsets[last - 1] + tables::sizes[last - 1] - tables::wire_offsets[first];
+            return covered != size;
+        }();
+
+        // native and wire representation are identical, so (arrays of) records can be copied as is
+        static constexpr bool verbatim = run_count == 1 && runs[0].verbatim && native_size == size;
+    };
+
+    template<meta::type_sequence::sequence_of_types Schema>
+    class flat_record;
+
+    // native representation of a record, fields are stored at `flat_layout<Schema>::native_offsets`
+    template<typename... Ts>
+    class flat_record<meta::type_sequence::type_sequence<Ts...>> {
+        using schema = meta::type_sequence::type_sequence<Ts...>;
+      public:
+        using layout = flat_layout<schema>;
+
+        // all fields are zero-initialized
+        flat_record() noexcept = default;
+
+        explicit flat_record(Ts const &... values) noexcept
+        {
+            [&]<size_t... Is>(std::index_sequence<Is...>) { ((get<Is>() = values), ...); }(
+              std::index_sequence_for<Ts...>{}
+            );
+        }
+
+        template<size_t I>
+        [[nodiscard]] layout::template type<I> & get() noexcept
+        {
+            return *std::launder(reinterpret_cast<layout::template type<I> *>(_storage + layout::native_offsets[I]));
+        }
+
+        template<size_t I>
+        [[nodiscard]] layout::template type<I> const & get() const noexcept
+        {
+            return *std::launder(
+              reinterpret_cast<layout::template type<I> const *>(_storage + layout::native_offsets[I])
+            );
+        }
+
+        [[nodiscard]] std::byte const * native_bytes() const noexcept { return _storage; }
+
+        [[nodiscard]] std::byte * native_bytes() noexcept { return _storage; }
+
+        template<size_t I>
+        friend layout::template type<I> & get(flat_record & rec) noexcept
+        {
+            return rec.get<I>();
+        }
+
+        template<size_t I>
+        friend layout::template type<I> const & get(flat_record const & rec) noexcept
+        {
+            return rec.get<I>();
+        }
+      private:
+        // padding stays zero, so it can be copied along with the fields
+        alignas(layout::native_alignment) std::byte _storage[layout::native_size]{};
+    };
+
+    // zero-copy read access to a serialized record
+    template<meta::type_sequence::sequence_of_types Schema>
+    class flat_view {
+      public:
+        using layout = flat_layout<Schema>;
+
+        explicit constexpr flat_view(std::byte const * data) noexcept : _data{data} {}
+
+        template<size_t I>
+        [[nodiscard]] layout::template type<I> get() const noexcept
+        {
+            return load<typename layout::template type<I>>(_data + layout::offsets[I]);
+        }
+
+        [[nodiscard]] constexpr std::span<std::byte const, layout::size> bytes() const noexcept
+        {
+            return std::span<std::byte const, layout::size>{_data, layout::size};
+        }
+
+        // view of the `index`-th of multiple records stored back to back
+        [[nodiscard]] constexpr flat_view operator[](size_t index) const noexcept
+        {
+            return flat_view{_data + index * layout::size};
+        }
+      private:
+        std::byte const * _data;
+    };
+
+    // writes `flat_layout<Schema>::size` bytes to `out` and returns the end of the written range
+    template<meta::type_sequence::sequence_of_types Schema>
+    std::byte * serialize(flat_record<Schema> const & rec, std::byte * out) noexcept
+    {
+        using layout = flat_layout<Schema>;
+        if constexpr(layout::sparse)
+            std::memset(out, 0, layout::size);
+        [&]<size_t... Rs>(std::index_sequence<Rs...>) {
+            (
+              [&] {
+                  constexpr auto run = layout::runs[Rs];
+                  if constexpr(run.verbatim) {
+                      constexpr auto bytes = layout::offsets[run.last - 1]
+                                           + sizeof(typename layout::template type<run.last - 1>)
+                                           - layout::offsets[run.first];
+                      std::memcpy(
+                        out + layout::offsets[run.first], rec.native_bytes() + layout::native_offsets[run.first], bytes
+                      );
+                  } else {
+                      store(out + layout::offsets[run.first], rec.template get<run.first>());
+                  }
+              }(),
+              ...
+            );
+        }(std::make_index_sequence<layout::run_count>{});
+        return out + layout::size;
+    }
+
+    // reads `flat_layout<Schema>::size` bytes from `in` and returns the end of the read range
+    template<meta::type_sequence::sequence_of_types Schema>
+    std::byte const * deserialize(std::byte const * in, flat_record<Schema> & rec) noexcept
+    {
+        using layout = flat_layout<Schema>;
+        [&]<size_t... Rs>(std::index_sequence<Rs...>) {
+            (
+              [&] {
+                  constexpr auto run = layout::runs[Rs];
+                  if constexpr(run.verbatim) {
+                      constexpr auto bytes = layout::offsets[run.last - 1]
+                                           + sizeof(typename layout::template type<run.last - 1>)
+                                           - layout::offsets[run.first];
+                      std::memcpy(
+                        rec.native_bytes() + layout::native_offsets[run.first], in + layout::offsets[run.first], bytes
+                      );
+                  } else {
+                      using type                 = layout::template type<run.first>;
+                      rec.template get<run.first>() = load<type>(in + layout::offsets[run.first]);
+                  }
+              }(),
+              ...
+            );
+        }(std::make_index_sequence<layout::run_count>{});
+        return in + layout::size;
+    }
+
+    template<meta::type_sequence::sequence_of_types Schema>
+    std::byte * serialize(std::span<flat_record<Schema> const> recs, std::byte * out) noexcept
+    {
+        if constexpr(flat_layout<Schema>::verbatim) {
+            if(!recs.empty())
+                std::memcpy(out, recs.data(), recs.size_bytes());
+            return out + recs.size_bytes();
+        } else {
+            for(auto & rec : recs)
+                out = serialize(rec, out);
+            return out;
+        }
+    }
+
+    template<meta::type_sequence::sequence_of_types Schema>
+    std::byte const * deserialize(std::byte const * in, std::span<flat_record<Schema>> recs) noexcept
+    {
+        if constexpr(flat_layout<Schema>::verbatim) {
+            if(!recs.empty())
+                std::memcpy(recs.data(), in, recs.size_bytes());
+            return in + recs.size_bytes();
+        } else {
+            for(auto & rec : recs)
+                in = deserialize(in, rec);
+            return in;
+        }
+    }
+}
+
+template<typename Schema>
+struct std::tuple_size<gstd::serialization::flat_record<Schema>>
+    : std::integral_constant<std::size_t, gstd::serialization::flat_layout<Schema>::count> {};
+
+template<std::size_t I, typename Schema>
+struct std::tuple_element<I, gstd::serialization::flat_record<Schema>>
+    : std::type_identity<typename gstd::serialization::flat_layout<Schema>::template type<I>> {};
+
+#endif
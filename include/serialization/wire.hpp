@@ -0,0 +1,105 @@
+#ifndef GSTD_SERIALIZATION_WIRE_HPP
+#define GSTD_SERIALIZATION_WIRE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+// The wire format is little-endian, every scalar is aligned to its own size and IEEE 754 floating point is assumed.
+
+namespace gstd::serialization {
+    using size_t = decltype(sizeof(nullptr));
+
+    namespace _impl {
+        template<typename T>
+        concept wire_scalar = (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::same_as<T, std::byte>)
+                              && std::has_single_bit(sizeof(T)) && sizeof(T) <= 8
+                              && (!std::is_floating_point_v<T> || std::numeric_limits<T>::is_iec559);
+
+        template<typename T>
+        struct wire_traits {};
+
+        template<wire_scalar T>
+        struct wire_traits<T> {
+            using scalar = T;
+
+            static constexpr size_t alignment = sizeof(T);
+            static constexpr size_t count     = 1;
+        };
+
+        template<typename T, size_t N>
+        requires requires { wire_traits<T>::alignment; }
+        struct wire_traits<std::array<T, N>> : wire_traits<T> {
+            static constexpr size_t count = wire_traits<T>::count * N;
+        };
+
+        template<typename T, size_t N>
+        requires requires { wire_traits<T>::alignment; }
+        struct wire_traits<T[N]> : wire_traits<std::array<T, N>> {};
+
+        template<size_t Size>
+        using unsigned_of_size = std::conditional_t<
+          Size == 1,
+          std::uint8_t,
+          std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>>>;
+    }
+
+    // scalars (arithmetic, enumeration or `std::byte`) and (nested) arrays thereof
+    template<typename T>
+    concept wire_type = std::is_trivially_copyable_v<T> && requires { _impl::wire_traits<T>::alignment; };
+
+    template<wire_type T>
+    inline constexpr size_t wire_alignment = _impl::wire_traits<T>::alignment;
+
+    // the in-memory representation of `T` is its wire representation, so it can be copied as is
+    template<wire_type T>
+    inline constexpr bool wire_verbatim = std::endian::native == std::endian::little
+                                          || sizeof(typename _impl::wire_traits<T>::scalar) == 1;
+
+    // writes `value` to `out`, which needn't be aligned
+    template<wire_type T>
+    void store(std::byte * out, T const & value) noexcept
+    {
+        if constexpr(wire_verbatim<T>) {
+            std::memcpy(out, &value, sizeof(T));
+        } else {
+            using scalar  = _impl::wire_traits<T>::scalar;
+            using integer = _impl::unsigned_of_size<sizeof(scalar)>;
+            scalar scalars[_impl::wire_traits<T>::count];
+            std::memcpy(scalars, &value, sizeof(T));
+            for(auto s : scalars) {
+                auto bits = std::byteswap(std::bit_cast<integer>(s));
+                std::memcpy(out, &bits, sizeof bits);
+                out += sizeof bits;
+            }
+        }
+    }
+
+    // reads a `T` from `in`, which needn't be aligned
+    template<wire_type T>
+    [[nodiscard]] T load(std::byte const * in) noexcept
+    {
+        T value;
+        if constexpr(wire_verbatim<T>) {
+            std::memcpy(&value, in, sizeof(T));
+        } else {
+            using scalar  = _impl::wire_traits<T>::scalar;
+            using integer = _impl::unsigned_of_size<sizeof(scalar)>;
+            scalar scalars[_impl::wire_traits<T>::count];
+            for(auto & s : scalars) {
+                integer bits;
+                std::memcpy(&bits, in, sizeof bits);
+                s   = std::bit_cast<scalar>(std::byteswap(bits));
+                in += sizeof bits;
+            }
+            std::memcpy(&value, scalars, sizeof(T));
+        }
+        return value;
+    }
+}
+
+#endif
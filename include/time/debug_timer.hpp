@@ -0,0 +1,26 @@
+#ifndef GSTD_TIME_DEBUG_TIMER_HPP
+#define GSTD_TIME_DEBUG_TIMER_HPP
+
+#include <iosfwd>
+#include "time/tsc_clock.hpp"
+
+namespace gstd::time {
+    class debug_timer {
+      public:
+        debug_timer(char const * name = nullptr) noexcept;
+        debug_timer(debug_timer const &)             = delete;
+        debug_timer & operator=(debug_timer const &) = delete;
+        // calls `display()` and inserts a newline
+        ~debug_timer();
+        // clears line and prints time since construction (no trailing newline)
+        void display() const;
+
+        // prints name and time since construction (without clearing the line or flushing)
+        friend std::ostream & operator<<(std::ostream & os, debug_timer const & timer);
+      private:
+        char const * _name;
+        tsc_clock::time_point _start_time;
+    };
+}
+
+#endif
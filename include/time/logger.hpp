@@ -0,0 +1,119 @@
+#ifndef GSTD_TIME_LOGGER_HPP
+#define GSTD_TIME_LOGGER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <string_view>
+#include "parallel/spsc_ring.hpp"
+#include "time/tsc_clock.hpp"
+#include "utility/thread_slots.hpp"
+
+// `logger` takes fixed-size binary records from a lock-free ring per thread and formats them on a background thread,
+// which writes whatever it drained at once to a sink (any `void(std::string_view)` callable, eg. `ostream_sink`).
+// Recording never blocks or allocates (after a thread's first record), records are dropped while its ring is full.
+// A thread's ring is freed once it has exited and been drained.
+// `logging_timer` logs the time spent in a scope as `name: elapsed`.
+
+namespace gstd::time {
+    using size_t = decltype(sizeof(nullptr));
+
+    using sink = std::function<void(std::string_view)>;
+
+    // the stream is flushed after every batch
+    [[nodiscard]] sink ostream_sink(std::ostream & os);
+    // writes to `fd` (which must remain open while the logger is alive)
+    [[nodiscard]] sink fd_sink(int fd);
+    // appends to (and closes) the file at `path`, throws `std::system_error` if it can't be opened
+    [[nodiscard]] sink file_sink(char const * path);
+
+    namespace _impl::logging {
+        struct record {
+            // `logging_timer`'s name, must outlive the logger
+            char const * name;
+            // `tsc_clock::ticks()` of the measurement
+            std::uint64_t ticks;
+        };
+
+        // single producer (the thread it belongs to), single consumer (the logger's thread)
+        using ring = parallel::spsc_ring<record>;
+
+        inline constexpr size_t ring_capacity = 1024;
+    }
+
+    class logger {
+      public:
+        // drains all rings every `interval` (and once more on destruction)
+        explicit logger(sink out, std::chrono::milliseconds interval = std::chrono::milliseconds{10});
+        logger(logger const &)             = delete;
+        logger & operator=(logger const &) = delete;
+        // records of all threads are written before it returns
+        ~logger();
+
+        // queues the record for the background thread
+        void log(char const * name, std::uint64_t ticks)
+        {
+            auto & ring = local();
+            if(!ring.try_push({name, ticks}))
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // registers the calling thread's ring, so its `log`s don't allocate
+        void reserve() { (void) local(); }
+
+        // records lost to full rings so far
+        [[nodiscard]] std::uint64_t dropped() const noexcept { return _dropped.load(std::memory_order_relaxed); }
+      private:
+        struct state;
+
+        [[nodiscard]] _impl::logging::ring & local()
+        {
+            if(auto * ring = utility::_impl::thread_slots::get(_id))
+                return *static_cast<_impl::logging::ring *>(ring);
+            return add_ring();
+        }
+
+        // registers a ring for the calling thread
+        [[nodiscard]] _impl::logging::ring & add_ring();
+
+        // marks an exiting thread's ring to be freed once it's drained
+        static void release(void * self, void * ring) noexcept;
+
+        // the calling thread's ring is in `utility::_impl::thread_slots`
+        size_t _id;
+        std::atomic<std::uint64_t> _dropped{0};
+        std::unique_ptr<state> _state;
+    };
+
+    // logs the time between its construction and destruction, `name` must outlive `out`
+    class logging_timer {
+      public:
+        // the thread's ring is registered before the clock starts
+        logging_timer(logger & out, char const * name) : _logger{out}, _name{name}
+        {
+            _logger.reserve();
+            _start = tsc_clock::ticks<fence::start>();
+        }
+
+        logging_timer(logging_timer const &)             = delete;
+        logging_timer & operator=(logging_timer const &) = delete;
+
+        ~logging_timer()
+        {
+            auto elapsed = tsc_clock::ticks<fence::stop>() - _start;
+            // only allocates if the scope was resumed on another thread, the record is dropped if that fails
+            try {
+                _logger.log(_name, elapsed);
+            } catch(...) {}
+        }
+      private:
+        logger & _logger;
+        char const * _name;
+        std::uint64_t _start;
+    };
+}
+
+#endif
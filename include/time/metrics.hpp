@@ -0,0 +1,190 @@
+#ifndef GSTD_TIME_METRICS_HPP
+#define GSTD_TIME_METRICS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "time/tsc_clock.hpp"
+#include "utility/thread_slots.hpp"
+
+// `metrics` is a registry of named latency distributions. Every thread records into its own high-dynamic-range
+// histogram per metric (single writer, no locks or read-modify-writes), `report()` merges them into percentiles. An
+// exited thread's histogram is merged into one of the metric and freed.
+// `scoped_timer` records the time spent in a scope (registering the thread's histogram up front).
+
+namespace gstd::time {
+    using size_t = decltype(sizeof(nullptr));
+
+    // log-linear buckets of nanoseconds: exact below 256, within 1/128 of the value above
+    // written by one thread at a time, any number of threads may read concurrently
+    class histogram {
+      public:
+        static constexpr unsigned sub_bucket_bits = 8;
+        // larger values are recorded as `max_value` (~78 hours)
+        static constexpr unsigned value_bits      = 48;
+        static constexpr std::uint64_t max_value  = (std::uint64_t{1} << value_bits) - 1;
+        static constexpr size_t buckets           = (size_t{1} << sub_bucket_bits)
+                                          + (value_bits - sub_bucket_bits) * (size_t{1} << (sub_bucket_bits - 1));
+
+        histogram();
+        histogram(histogram const &)             = delete;
+        histogram & operator=(histogram const &) = delete;
+
+        void record(std::uint64_t value) noexcept
+        {
+            value = std::min(value, max_value);
+            increment(_counts[index(value)], 1);
+            increment(_count, 1);
+            if(value > _max.load(std::memory_order_relaxed))
+                _max.store(value, std::memory_order_relaxed);
+        }
+
+        // adds the counts of `other` (which may be written concurrently)
+        void merge(histogram const & other) noexcept;
+
+        [[nodiscard]] std::uint64_t count() const noexcept { return _count.load(std::memory_order_relaxed); }
+
+        [[nodiscard]] std::uint64_t max() const noexcept { return _max.load(std::memory_order_relaxed); }
+
+        // the value at or below which `q` of all recorded values are (rounded up to its bucket), 0 if empty
+        [[nodiscard]] std::uint64_t quantile(double q) const noexcept;
+
+        [[nodiscard]] static constexpr size_t index(std::uint64_t value) noexcept
+        {
+            constexpr auto half = size_t{1} << (sub_bucket_bits - 1);
+            auto magnitude      = static_cast<unsigned>(std::bit_width(value));
+            if(magnitude <= sub_bucket_bits)
+                return static_cast<size_t>(value);
+            auto shift = magnitude - sub_bucket_bits;
+            return 2 * half + (shift - 1) * half + (static_cast<size_t>(value >> shift) - half);
+        }
+
+        // largest value in the bucket at `i`
+        [[nodiscard]] static constexpr std::uint64_t highest(size_t i) noexcept
+        {
+            constexpr auto half = size_t{1} << (sub_bucket_bits - 1);
+            if(i < 2 * half)
+                return i;
+            auto shift = static_cast<unsigned>((i - 2 * half) / half + 1);
+            auto top   = static_cast<std::uint64_t>((i - 2 * half) % half + half);
+            return ((top + 1) << shift) - 1;
+        }
+      private:
+        // only ever written by one thread
+        static void increment(std::atomic<std::uint64_t> & counter, std::uint64_t n) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+
+        std::unique_ptr<std::atomic<std::uint64_t>[]> _counts;
+        std::atomic<std::uint64_t> _count{0};
+        std::atomic<std::uint64_t> _max{0};
+    };
+
+    struct summary {
+        std::string name;
+        std::uint64_t count;
+        tsc_clock::duration p50;
+        tsc_clock::duration p99;
+        tsc_clock::duration p999;
+        tsc_clock::duration max;
+    };
+
+    // `name: count p50 p99 p99.9 max`
+    std::ostream & operator<<(std::ostream & os, summary const & s);
+
+    class metrics {
+      public:
+        // latency distribution, recorded into a histogram per thread
+        class metric {
+          public:
+            explicit metric(std::string name);
+            metric(metric const &)             = delete;
+            metric & operator=(metric const &) = delete;
+            ~metric();
+
+            void record(tsc_clock::duration elapsed)
+            {
+                local().record(static_cast<std::uint64_t>(std::max(elapsed.count(), tsc_clock::rep{0})));
+            }
+
+            // registers the calling thread's histogram, so its `record`s don't allocate
+            void reserve() { (void) local(); }
+
+            [[nodiscard]] std::string const & name() const noexcept { return _name; }
+
+            // the histograms of all threads (including exited ones) merged
+            [[nodiscard]] summary report() const;
+          private:
+            [[nodiscard]] histogram & local()
+            {
+                if(auto * shard = utility::_impl::thread_slots::get(_id))
+                    return *static_cast<histogram *>(shard);
+                return add_shard();
+            }
+
+            // registers a histogram for the calling thread
+            [[nodiscard]] histogram & add_shard();
+
+            // merges an exiting thread's histogram into `_exited` and frees it
+            static void release(void * self, void * shard) noexcept;
+
+            std::string _name;
+            // the calling thread's histogram is in `utility::_impl::thread_slots`
+            size_t _id;
+            mutable std::mutex _mutex;
+            std::vector<std::unique_ptr<histogram>> _shards;
+            // the histograms of exited threads
+            histogram _exited;
+        };
+
+        metrics() noexcept = default;
+        metrics(metrics const &)             = delete;
+        metrics & operator=(metrics const &) = delete;
+
+        // registers `name` on first use, the reference stays valid as long as `*this`
+        [[nodiscard]] metric & operator[](std::string_view name);
+
+        // all metrics by name
+        [[nodiscard]] std::vector<summary> report() const;
+      private:
+        mutable std::mutex _mutex;
+        std::map<std::string, std::unique_ptr<metric>, std::less<>> _metrics;
+    };
+
+    // records the time between its construction and destruction into `m`
+    class scoped_timer {
+      public:
+        // the thread's histogram is registered before the clock starts
+        explicit scoped_timer(metrics::metric & m) : _metric{m}
+        {
+            _metric.reserve();
+            _start = tsc_clock::ticks<fence::start>();
+        }
+
+        scoped_timer(scoped_timer const &)             = delete;
+        scoped_timer & operator=(scoped_timer const &) = delete;
+
+        ~scoped_timer()
+        {
+            auto elapsed = tsc_clock::ticks<fence::stop>() - _start;
+            // only allocates if the scope was resumed on another thread, the sample is dropped if that fails
+            try {
+                _metric.record(tsc_clock::to_duration(static_cast<std::int64_t>(elapsed)));
+            } catch(...) {}
+        }
+      private:
+        metrics::metric & _metric;
+        std::uint64_t _start;
+    };
+}
+
+#endif
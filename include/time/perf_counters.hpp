@@ -0,0 +1,92 @@
+#ifndef GSTD_TIME_PERF_COUNTERS_HPP
+#define GSTD_TIME_PERF_COUNTERS_HPP
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include "time/tsc_clock.hpp"
+
+// `perf_counter_group` opens hardware counters of the calling thread as one `perf_event_open(2)` group (Linux only),
+// so a single `read` returns all of them for the same instant, scaled if the kernel had to multiplex them.
+// Counters that aren't supported or permitted (see /proc/sys/kernel/perf_event_paranoid) are left out, in the worst
+// case samples only contain the time. `scoped_counters` adds the counts of a scope to a sample, like `cycle_timer`.
+
+namespace gstd::time {
+    using size_t = decltype(sizeof(nullptr));
+
+    enum class counter : unsigned char {
+        cycles,
+        instructions,
+        cache_misses,
+        branch_misses,
+        llc_misses, // last-level cache read misses
+    };
+
+    inline constexpr size_t counter_count = 5;
+
+    // counts since the group was opened (or between two of those if subtracted)
+    struct perf_sample {
+        [[nodiscard]] std::optional<std::uint64_t> operator[](counter c) const noexcept
+        {
+            auto i = static_cast<size_t>(c);
+            return available[i] ? std::optional{values[i]} : std::nullopt;
+        }
+
+        // instructions per cycle, `std::nullopt` if either isn't available or no cycles were counted
+        [[nodiscard]] std::optional<double> ipc() const noexcept;
+
+        // counters available in both
+        friend perf_sample operator-(perf_sample const & lhs, perf_sample const & rhs) noexcept;
+        // counters available in either
+        perf_sample & operator+=(perf_sample const & rhs) noexcept;
+
+        std::array<std::uint64_t, counter_count> values{};
+        std::bitset<counter_count> available;
+        tsc_clock::duration time{};
+    };
+
+    // `time cycles instructions ipc ...` (available counters only)
+    std::ostream & operator<<(std::ostream & os, perf_sample const & s);
+
+    class perf_counter_group {
+      public:
+        // counts the calling thread from now on
+        perf_counter_group() noexcept;
+        perf_counter_group(perf_counter_group const &)             = delete;
+        perf_counter_group & operator=(perf_counter_group const &) = delete;
+        ~perf_counter_group();
+
+        [[nodiscard]] bool available(counter c) const noexcept { return _available[static_cast<size_t>(c)]; }
+
+        // all counters at once (a single system call) and `tsc_clock::now()`
+        [[nodiscard]] perf_sample read() const noexcept;
+      private:
+        // group leader, -1 if no counter could be opened
+        int _leader = -1;
+        std::array<int, counter_count> _fds;
+        // counters in the order the group reports them
+        std::array<counter, counter_count> _order{};
+        std::bitset<counter_count> _available;
+    };
+
+    // adds the counts between its construction and destruction to `total`
+    class scoped_counters {
+      public:
+        scoped_counters(perf_counter_group const & group, perf_sample & total) noexcept
+            : _group{group}, _total{total}, _start{group.read()}
+        {}
+
+        scoped_counters(scoped_counters const &)             = delete;
+        scoped_counters & operator=(scoped_counters const &) = delete;
+
+        ~scoped_counters() { _total += _group.read() - _start; }
+      private:
+        perf_counter_group const & _group;
+        perf_sample & _total;
+        perf_sample _start;
+    };
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef GSTD_TIME_TRACE_HPP
+#define GSTD_TIME_TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include "time/tsc_clock.hpp"
+#include "utility/concat.hpp"
+
+// `trace::span` records its begin & end (counter ticks) and a static name into a buffer of the calling thread.
+// `trace::write` exports the spans of all threads recorded so far as Chrome Trace Event JSON (which Perfetto and
+// chrome://tracing load), `trace::write_at_exit` does so once the process exits. Spans are kept until then.
+// Defining `GSTD_TRACE_DISABLE` makes `GSTD_TRACE_SPAN` expand to nothing (`span` itself is the same in every
+// translation unit). Spans are dropped while no chunk can be allocated for them.
+
+#ifdef GSTD_TRACE_DISABLE
+#define GSTD_TRACE_SPAN(name) static_cast<void>(0)
+#else
+#define GSTD_TRACE_SPAN(name) \
+    ::gstd::time::trace::span const GSTD_UTILITY_CONCAT(_gstd_trace_span, __LINE__) { name }
+#endif
+
+namespace gstd::time::trace {
+    using size_t = decltype(sizeof(nullptr));
+
+    namespace _impl {
+        struct event {
+            char const * name;
+            std::uint64_t begin;
+            std::uint64_t end;
+        };
+
+        // appended to by one thread, exported by any
+        struct chunk {
+            static constexpr size_t capacity = 4096;
+
+            // events published so far
+            std::atomic<size_t> size{0};
+            event events[capacity];
+        };
+
+        // the calling thread's current chunk
+        inline thread_local constinit chunk * local = nullptr;
+
+        // starts a new chunk for the calling thread, null if it can't be allocated
+        [[nodiscard]] chunk * add_chunk() noexcept;
+
+        // dropped if the calling thread's chunk is full and no new one can be allocated
+        inline void record(char const * name, std::uint64_t begin, std::uint64_t end) noexcept
+        {
+            auto * c = local;
+            auto n   = c ? c->size.load(std::memory_order_relaxed) : chunk::capacity;
+            if(n == chunk::capacity) {
+                if(!(c = add_chunk()))
+                    return;
+                n = 0;
+            }
+            c->events[n] = {name, begin, end};
+            c->size.store(n + 1, std::memory_order_release);
+        }
+    }
+
+    // `name` must stay valid until the trace is written
+    class span {
+      public:
+        explicit span(char const * name) noexcept : _name{name}, _begin{tsc_clock::ticks()} {}
+
+        span(span const &)             = delete;
+        span & operator=(span const &) = delete;
+
+        ~span() { _impl::record(_name, _begin, tsc_clock::ticks()); }
+      private:
+        char const * _name;
+        std::uint64_t _begin;
+    };
+
+    // all spans recorded so far (by any thread) as a JSON object
+    void write(std::ostream & os);
+
+    // writes the trace to `path` when the process exits (the last call wins)
+    void write_at_exit(char const * path);
+}
+
+#endif
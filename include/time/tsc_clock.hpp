@@ -0,0 +1,154 @@
+#ifndef GSTD_TIME_TSC_CLOCK_HPP
+#define GSTD_TIME_TSC_CLOCK_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <ratio>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define GSTD_TIME_TSC 1
+#else
+#define GSTD_TIME_TSC 0
+#endif
+
+// `tsc_clock` reads the time-stamp counter, which ticks at a constant rate on CPUs with an invariant TSC, and converts
+// it to nanoseconds with a fixed-point factor measured against `std::chrono::steady_clock` (see src/tsc_clock.cpp) by
+// the first conversion, or earlier by `tsc_clock::calibrate()`. Reading the counter never waits for the measurement.
+// Its time points share `steady_clock`'s epoch. Without an invariant TSC (or `rdtscp`) all reads fall back to
+// `steady_clock`.
+// `cycle_timer` adds the time spent in a scope to a duration, for timing hot paths at a few dozen cycles per scope.
+
+namespace gstd::time {
+    // ordering of a counter read relative to the surrounding instructions
+    enum class fence {
+        none,  // `rdtsc`, may be reordered both ways
+        start, // `lfence; rdtsc; lfence`, nothing before is still running and nothing after has started
+        stop,  // `rdtscp; lfence`, everything before has finished and nothing after has started
+    };
+
+    namespace _impl::tsc {
+        struct calibration {
+            // `tsc_clock::ticks()` and `steady_clock` (in nanoseconds) at the same moment
+            std::uint64_t ticks;
+            std::int64_t nanoseconds;
+            // nanoseconds per tick with `shift` fractional bits
+            std::uint64_t multiplier;
+            unsigned shift;
+        };
+
+        // invariant TSC (constant rate in all power states) and `rdtscp`
+        [[nodiscard]] bool usable() noexcept;
+
+        [[nodiscard]] inline bool invariant() noexcept
+        {
+            static bool const supported = usable();
+            return supported;
+        }
+
+        // the identity for `steady_clock` nanoseconds without an invariant TSC, sleeps for a few milliseconds otherwise
+        [[nodiscard]] calibration calibrate() noexcept;
+
+        [[nodiscard]] inline calibration const & calibrated() noexcept
+        {
+            static calibration const c = calibrate();
+            return c;
+        }
+
+        [[nodiscard]] inline std::uint64_t steady() noexcept
+        {
+            auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<std::uint64_t>(std::chrono::nanoseconds{now}.count());
+        }
+
+        template<fence F>
+        [[nodiscard]] inline std::uint64_t read() noexcept
+        {
+#if GSTD_TIME_TSC
+            if constexpr(F == fence::none) {
+                return __rdtsc();
+            } else if constexpr(F == fence::start) {
+                _mm_lfence();
+                auto ticks = __rdtsc();
+                _mm_lfence();
+                return ticks;
+            } else {
+                unsigned aux;
+                auto ticks = __rdtscp(&aux);
+                _mm_lfence();
+                return ticks;
+            }
+#else
+            return steady();
+#endif
+        }
+    }
+
+    struct tsc_clock {
+        using rep                       = std::int64_t;
+        using period                    = std::nano;
+        using duration                  = std::chrono::nanoseconds;
+        using time_point                = std::chrono::time_point<tsc_clock>;
+        static constexpr bool is_steady = true;
+
+        // whether the counter is read, `steady_clock` is used otherwise
+        [[nodiscard]] static bool invariant() noexcept { return _impl::tsc::invariant(); }
+
+        // measures the counter's rate now (taking about 20 ms) rather than in the first conversion
+        static void calibrate() noexcept { (void) _impl::tsc::calibrated(); }
+
+        // raw counter (nanoseconds if not `invariant()`), for differences to be converted by `to_duration()`
+        template<fence F = fence::none>
+        [[nodiscard]] static std::uint64_t ticks() noexcept
+        {
+            return invariant() ? _impl::tsc::read<F>() : _impl::tsc::steady();
+        }
+
+        [[nodiscard]] static duration to_duration(std::int64_t ticks) noexcept
+        {
+            __extension__ using int128 = __int128;
+            auto & c = _impl::tsc::calibrated();
+            return duration{static_cast<rep>(int128{ticks} * static_cast<int128>(c.multiplier) >> c.shift)};
+        }
+
+        // the time point a `ticks()` reading was taken at
+        [[nodiscard]] static time_point from_ticks(std::uint64_t ticks) noexcept
+        {
+            auto & c   = _impl::tsc::calibrated();
+            auto since = static_cast<std::int64_t>(ticks - c.ticks);
+            return time_point{duration{c.nanoseconds} + to_duration(since)};
+        }
+
+        template<fence F = fence::none>
+        [[nodiscard]] static time_point now() noexcept
+        {
+            return from_ticks(ticks<F>());
+        }
+    };
+
+    // adds the time between its construction and destruction to `total`
+    class cycle_timer {
+      public:
+        explicit cycle_timer(tsc_clock::duration & total) noexcept
+            : _total{total}, _start{tsc_clock::ticks<fence::start>()}
+        {}
+
+        cycle_timer(cycle_timer const &)             = delete;
+        cycle_timer & operator=(cycle_timer const &) = delete;
+
+        ~cycle_timer() { _total += elapsed(); }
+
+        // counter ticks since construction
+        [[nodiscard]] std::uint64_t ticks() const noexcept { return tsc_clock::ticks<fence::stop>() - _start; }
+
+        [[nodiscard]] tsc_clock::duration elapsed() const noexcept
+        {
+            return tsc_clock::to_duration(static_cast<std::int64_t>(ticks()));
+        }
+      private:
+        tsc_clock::duration & _total;
+        std::uint64_t _start;
+    };
+}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef GSTD_UTILITY_CONCAT_HPP
+#define GSTD_UTILITY_CONCAT_HPP
+
+// pastes `a` & `b` after expanding them (eg. `GSTD_UTILITY_CONCAT(name, __LINE__)`)
+
+#define GSTD_UTILITY_CONCAT_IMPL(a, b) a##b
+#define GSTD_UTILITY_CONCAT(a, b)      GSTD_UTILITY_CONCAT_IMPL(a, b)
+
+#endif
@@ -0,0 +1,304 @@
+#ifndef GSTD_UTILITY_FUNCTION_HPP
+#define GSTD_UTILITY_FUNCTION_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/aligned.hpp"
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+
+// Type-erased callables like `std::function`/`std::move_only_function` (`R(Args...)`, optionally `noexcept`).
+// Targets of up to `InlineSize` bytes that can be moved without throwing are stored inline, larger ones in memory from
+// `Alloc` (stateless allocators are held by value, any other has to be passed on construction and outlive the
+// function). Calls jump through a single function pointer, which throws `std::bad_function_call` (or terminates for
+// `noexcept` signatures) while empty.
+// Like `std::function`, `operator()` is `const` but invokes the target as a non-`const` lvalue.
+
+namespace gstd::utility {
+    using size_t = decltype(sizeof(nullptr));
+
+    template<typename Signature, size_t InlineSize = 4 * sizeof(void *), typename Alloc = allocation::c_allocator_type>
+    class function;
+
+    template<typename Signature, size_t InlineSize = 4 * sizeof(void *), typename Alloc = allocation::c_allocator_type>
+    class move_only_function;
+
+    namespace _impl::function {
+        enum class operation {
+            move,    // into `*other` (empty), leaving `self` empty
+            copy,    // into `*other` (empty)
+            destroy, // leaving `self` empty
+        };
+
+        template<
+          bool Copyable,
+          size_t InlineSize,
+          allocation::allocator Alloc,
+          bool Noexcept,
+          typename R,
+          typename... Args>
+        class base {
+            static_assert(InlineSize >= sizeof(allocation::allocation_result), "must fit a pointer to the target");
+
+            static constexpr bool stateless = allocation::stateless_allocator<Alloc>;
+
+            using allocation_result = allocation::allocation_result;
+
+            using invoker = R (*)(std::byte *, Args &&...) noexcept(Noexcept);
+            using manager = void (*)(operation, base &, base *);
+
+            template<typename T>
+            static constexpr bool stored_inline = sizeof(T) <= InlineSize && alignof(T) <= alignof(std::max_align_t)
+                                                  && std::is_nothrow_move_constructible_v<T>;
+
+            // lazily, `F` may be a function itself
+            template<typename F, typename T = std::decay_t<F>>
+            static constexpr bool target = std::conjunction_v<
+              std::negation<std::is_base_of<base, T>>,
+              std::is_constructible<T, F>,
+              std::conditional_t<
+                Noexcept,
+                std::is_nothrow_invocable_r<R, T &, Args...>,
+                std::is_invocable_r<R, T &, Args...>>,
+              std::disjunction<std::bool_constant<!Copyable>, std::is_copy_constructible<T>>>;
+          public:
+            using result_type = R;
+
+            base() noexcept = default;
+
+            base(std::nullptr_t) noexcept {}
+
+            template<typename F>
+            requires target<F> && allocation::stateless_allocator<Alloc>
+            base(F && f)
+            {
+                emplace(static_cast<F &&>(f));
+            }
+
+            template<typename F>
+            requires target<F> && (!allocation::stateless_allocator<Alloc>)
+            base(F && f, Alloc & alloc) : _alloc{std::addressof(alloc)}
+            {
+                emplace(static_cast<F &&>(f));
+            }
+
+            base(base const & other)
+            requires Copyable
+                : _alloc{other._alloc}
+            {
+                if(other._manage)
+                    other._manage(operation::copy, const_cast<base &>(other), this);
+            }
+
+            base(base && other) noexcept : _alloc{other._alloc}
+            {
+                if(other._manage)
+                    other._manage(operation::move, other, this);
+            }
+
+            base & operator=(base const & rhs)
+            requires Copyable
+            {
+                if(this != &rhs) {
+                    base copy{rhs};
+                    *this = std::move(copy);
+                }
+                return *this;
+            }
+
+            base & operator=(base && rhs) noexcept
+            {
+                if(this != &rhs) {
+                    reset();
+                    _alloc = rhs._alloc;
+                    if(rhs._manage)
+                        rhs._manage(operation::move, rhs, this);
+                }
+                return *this;
+            }
+
+            base & operator=(std::nullptr_t) noexcept
+            {
+                reset();
+                return *this;
+            }
+
+            // uses the current allocator
+            template<typename F>
+            requires target<F>
+            base & operator=(F && f)
+            {
+                base tmp;
+                tmp._alloc = _alloc;
+                tmp.emplace(static_cast<F &&>(f));
+                return *this = std::move(tmp);
+            }
+
+            ~base() { reset(); }
+
+            R operator()(Args... args) const noexcept(Noexcept)
+            {
+                return _invoke(const_cast<std::byte *>(_storage), static_cast<Args &&>(args)...);
+            }
+
+            [[nodiscard]] explicit operator bool() const noexcept { return _manage; }
+
+            [[nodiscard]] friend bool operator==(base const & f, std::nullptr_t) noexcept { return !f; }
+
+            void swap(base & other) noexcept
+            {
+                base tmp{std::move(other)};
+                other = std::move(*this);
+                *this = std::move(tmp);
+            }
+
+            friend void swap(base & lhs, base & rhs) noexcept { lhs.swap(rhs); }
+          private:
+            [[nodiscard]] Alloc & get() noexcept
+            {
+                if constexpr(stateless)
+                    return _alloc;
+                else
+                    return *_alloc;
+            }
+
+            template<typename T>
+            [[nodiscard]] static T & get_target(std::byte * storage) noexcept
+            {
+                if constexpr(stored_inline<T>)
+                    return *std::launder(reinterpret_cast<T *>(storage));
+                else
+                    return *static_cast<T *>(allocation::align_up(
+                      std::launder(reinterpret_cast<allocation_result *>(storage))->ptr,
+                      alignof(T)
+                    ));
+            }
+
+            template<typename T>
+            static R invoke(std::byte * storage, Args &&... args) noexcept(Noexcept)
+            {
+                return std::invoke_r<R>(get_target<T>(storage), static_cast<Args &&>(args)...);
+            }
+
+            static R invoke_empty(std::byte *, Args &&...) noexcept(Noexcept)
+            {
+                if constexpr(Noexcept)
+                    std::terminate();
+                else
+                    throw std::bad_function_call{};
+            }
+
+            template<typename T>
+            static void manage(operation op, base & self, base * other)
+            {
+                switch(op) {
+                case operation::move:
+                    if constexpr(stored_inline<T>) {
+                        ::new(other->_storage) T(std::move(get_target<T>(self._storage)));
+                        std::destroy_at(std::addressof(get_target<T>(self._storage)));
+                    } else {
+                        // the allocation moves along with the allocator
+                        std::memcpy(other->_storage, self._storage, sizeof(allocation_result));
+                    }
+                    other->_invoke = std::exchange(self._invoke, &invoke_empty);
+                    other->_manage = std::exchange(self._manage, nullptr);
+                    break;
+                case operation::copy:
+                    if constexpr(Copyable)
+                        other->emplace(static_cast<T const &>(get_target<T>(self._storage)));
+                    break;
+                case operation::destroy:
+                    std::destroy_at(std::addressof(get_target<T>(self._storage)));
+                    if constexpr(!stored_inline<T>)
+                        self.get().deallocate(*std::launder(reinterpret_cast<allocation_result *>(self._storage)));
+                    self._invoke = &invoke_empty;
+                    self._manage = nullptr;
+                    break;
+                }
+            }
+
+            template<typename F>
+            void emplace(F && f)
+            {
+                using T = std::decay_t<F>;
+                // null (member) function pointers leave the function empty
+                if constexpr(std::is_pointer_v<std::remove_reference_t<F>> || std::is_member_pointer_v<T>)
+                    if(!f)
+                        return;
+                if constexpr(stored_inline<T>) {
+                    ::new(_storage) T(static_cast<F &&>(f));
+                } else {
+                    if constexpr(!stateless)
+                        if(!_alloc)
+                            throw std::bad_alloc{};
+                    // only the allocation is stored, the target is found by aligning its pointer again
+                    auto [ptr, allocation] = allocation::allocate_aligned(get(), sizeof(T), alignof(T));
+                    if(!ptr)
+                        throw std::bad_alloc{};
+                    try {
+                        ::new(ptr) T(static_cast<F &&>(f));
+                    } catch(...) {
+                        get().deallocate(allocation);
+                        throw;
+                    }
+                    ::new(_storage) allocation_result{allocation};
+                }
+                _invoke = &invoke<T>;
+                _manage = &manage<T>;
+            }
+
+            void reset() noexcept
+            {
+                if(_manage)
+                    _manage(operation::destroy, *this, nullptr);
+            }
+
+            // the target or the `allocation_result` holding it
+            alignas(std::max_align_t) std::byte _storage[InlineSize];
+            invoker _invoke = &invoke_empty;
+            // `nullptr` while empty
+            manager _manage = nullptr;
+            [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc{};
+        };
+    }
+
+    template<typename R, typename... Args, size_t InlineSize, typename Alloc>
+    class function<R(Args...), InlineSize, Alloc>
+        : public _impl::function::base<true, InlineSize, Alloc, false, R, Args...> {
+      public:
+        using _impl::function::base<true, InlineSize, Alloc, false, R, Args...>::base;
+        using _impl::function::base<true, InlineSize, Alloc, false, R, Args...>::operator=;
+    };
+
+    template<typename R, typename... Args, size_t InlineSize, typename Alloc>
+    class function<R(Args...) noexcept, InlineSize, Alloc>
+        : public _impl::function::base<true, InlineSize, Alloc, true, R, Args...> {
+      public:
+        using _impl::function::base<true, InlineSize, Alloc, true, R, Args...>::base;
+        using _impl::function::base<true, InlineSize, Alloc, true, R, Args...>::operator=;
+    };
+
+    template<typename R, typename... Args, size_t InlineSize, typename Alloc>
+    class move_only_function<R(Args...), InlineSize, Alloc>
+        : public _impl::function::base<false, InlineSize, Alloc, false, R, Args...> {
+      public:
+        using _impl::function::base<false, InlineSize, Alloc, false, R, Args...>::base;
+        using _impl::function::base<false, InlineSize, Alloc, false, R, Args...>::operator=;
+    };
+
+    template<typename R, typename... Args, size_t InlineSize, typename Alloc>
+    class move_only_function<R(Args...) noexcept, InlineSize, Alloc>
+        : public _impl::function::base<false, InlineSize, Alloc, true, R, Args...> {
+      public:
+        using _impl::function::base<false, InlineSize, Alloc, true, R, Args...>::base;
+        using _impl::function::base<false, InlineSize, Alloc, true, R, Args...>::operator=;
+    };
+}
+
+#endif
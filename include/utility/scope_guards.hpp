@@ -4,11 +4,9 @@
 // inspired by https://youtu.be/WjTrfoiB0MQ and std::experimental
 
 #include <exception>
+#include <utility/concat.hpp>
 #include <utility/static_false.hpp>
 
-#define GSTD_UTILITY_CONCAT_IMPL(a, b) a##b
-#define GSTD_UTILITY_CONCAT(a, b)      GSTD_UTILITY_CONCAT_IMPL(a, b)
-
 // macros don't work when used multiple times per line :(
 #define GSTD_SCOPE_GUARD_IMPL(I)                                                               \
     [[maybe_unused]] auto const GSTD_UTILITY_CONCAT(_gstd_scope_guard, __LINE__)               \
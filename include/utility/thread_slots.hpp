@@ -0,0 +1,53 @@
+#ifndef GSTD_UTILITY_THREAD_SLOTS_HPP
+#define GSTD_UTILITY_THREAD_SLOTS_HPP
+
+// Per-thread, per-object pointers (eg. a histogram of every thread for every metric): every object takes an id, which
+// indexes a table of the calling thread. Looking a slot up is a bounds check and a load, only making room for a slot
+// allocates. The table is freed when its thread exits, after calling the `release` functions of the slots whose
+// objects still exist. Once it's gone (in `thread_local` destructors running later) no slot can be made anymore.
+
+namespace gstd::utility::_impl::thread_slots {
+    using size_t = decltype(sizeof(nullptr));
+
+    // called with a slot's `owner` and pointer when its thread exits
+    using release_fn = void (*)(void * owner, void * ptr) noexcept;
+
+    struct slot {
+        void * ptr;
+        release_fn release;
+        void * owner;
+    };
+
+    // the calling thread's slots, indexed by id
+    struct table {
+        slot * data;
+        size_t size;
+    };
+
+    inline thread_local constinit table local{nullptr, 0};
+
+    // process-wide, never reused
+    [[nodiscard]] size_t new_id();
+
+    // has to be called before the object that took `id` is destroyed, waits for running `release`s of it to return
+    // and skips it in later ones
+    void retire(size_t id) noexcept;
+
+    // makes room for slot `id` in the calling thread's table, throws `std::runtime_error` once the table is destroyed
+    void reserve(size_t id);
+
+    // the calling thread's pointer in slot `id`, null if it hasn't set one
+    [[nodiscard]] inline void * get(size_t id) noexcept
+    {
+        auto & slots = local;
+        return id < slots.size ? slots.data[id].ptr : nullptr;
+    }
+
+    // slot `id` has to be reserved by the calling thread
+    inline void set(size_t id, void * ptr, release_fn release = nullptr, void * owner = nullptr) noexcept
+    {
+        local.data[id] = {ptr, release, owner};
+    }
+}
+
+#endif
@@ -0,0 +1,202 @@
+#ifndef GSTD_UTILITY_TRANSACTION_HPP
+#define GSTD_UTILITY_TRANSACTION_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "allocation/base.hpp"
+#include "allocation/c_allocator.hpp"
+
+// Undo log for multi-step updates, a cheaper replacement for a `GSTD_SCOPE_FAILURE` guard per step: every step records
+// how to revert itself with `on_rollback`, the actions are stacked in `Capacity` inline bytes (then in blocks from
+// `Alloc`) and `std::uncaught_exceptions()` is only queried on construction and destruction.
+// Leaving the scope by an exception runs all recorded actions in reverse order, leaving it normally (or `commit()`)
+// discards them. Discarding is O(1) unless an action isn't trivially destructible.
+// Actions are invoked from the destructor, an exception escaping one of them terminates.
+
+namespace gstd::utility {
+    using size_t = decltype(sizeof(nullptr));
+
+    template<size_t Capacity = 256, allocation::allocator Alloc = allocation::c_allocator_type>
+    class transaction {
+        static constexpr bool stateless = allocation::stateless_allocator<Alloc>;
+
+        // behind every action
+        struct entry {
+            // destroys the action at `object` after invoking it if `run`
+            void (*finish)(void * object, bool run) noexcept;
+            void * object;
+            std::byte * previous_top;
+        };
+
+        // at the beginning of every block from `Alloc`, the state of the previous block
+        struct block {
+            allocation::allocation_result allocation;
+            std::byte * previous_begin;
+            std::byte * previous_top;
+            std::byte * previous_end;
+        };
+
+        template<typename F>
+        static void finish(void * object, bool run) noexcept
+        {
+            auto & action = *static_cast<F *>(object);
+            if(run)
+                action();
+            std::destroy_at(std::addressof(action));
+        }
+
+        [[nodiscard]] static std::byte * align(std::byte * ptr, size_t alignment) noexcept
+        {
+            auto misalignment = reinterpret_cast<std::uintptr_t>(ptr) % alignment;
+            return misalignment ? ptr + (alignment - misalignment) : ptr;
+        }
+      public:
+        transaction() noexcept
+        requires allocation::stateless_allocator<Alloc>
+            : _exceptions{std::uncaught_exceptions()}
+        {}
+
+        explicit transaction(Alloc & alloc) noexcept
+        requires (!allocation::stateless_allocator<Alloc>)
+            : _alloc{std::addressof(alloc)}, _exceptions{std::uncaught_exceptions()}
+        {}
+
+        transaction(transaction const &)             = delete;
+        transaction & operator=(transaction const &) = delete;
+
+        ~transaction()
+        {
+            if(std::uncaught_exceptions() > _exceptions)
+                rollback();
+            else
+                commit();
+        }
+
+        // records `undo` to be invoked if the transaction is rolled back
+        // if it can't be recorded, `undo()` is invoked right away and `std::bad_alloc` thrown
+        template<typename F>
+        requires std::invocable<std::decay_t<F> &>
+        void on_rollback(F && undo)
+        {
+            using action = std::decay_t<F>;
+            static_assert(alignof(action) <= alignof(std::max_align_t), "over-aligned actions aren't supported");
+            auto * object = place(sizeof(action), alignof(action));
+            if(!object) {
+                undo();
+                throw std::bad_alloc{};
+            }
+            try {
+                ::new(object) action(static_cast<F &&>(undo));
+            } catch(...) {
+                undo();
+                throw;
+            }
+            auto * header = align(object + sizeof(action), alignof(entry));
+            ::new(header) entry{&finish<action>, object, _top};
+            _top = header + sizeof(entry);
+            _trivial &= std::is_trivially_destructible_v<action>;
+        }
+
+        // discards all recorded actions
+        void commit() noexcept
+        {
+            if(_trivial)
+                release();
+            else
+                unwind(false);
+        }
+
+        // invokes all recorded actions in reverse order
+        void rollback() noexcept { unwind(true); }
+
+        // no recorded actions
+        [[nodiscard]] bool empty() const noexcept { return _top == _inline; }
+      private:
+        [[nodiscard]] Alloc & get() noexcept
+        {
+            if constexpr(stateless)
+                return _alloc;
+            else
+                return *_alloc;
+        }
+
+        // room for an action followed by its entry, `nullptr` if out of memory
+        [[nodiscard]] std::byte * place(size_t size, size_t alignment) noexcept
+        {
+            auto fits = [&](std::byte * top, std::byte * end) {
+                auto * object = align(top, alignment);
+                auto * header = align(object + size, alignof(entry));
+                return header + sizeof(entry) <= end ? object : nullptr;
+            };
+            if(auto * object = fits(_top, _end))
+                return object;
+            // twice the previous block, at least enough for the action, rounded so bump allocators stay aligned
+            constexpr auto granularity = alignof(std::max_align_t);
+            auto needed                = sizeof(block) + alignment + size + alignof(entry) + sizeof(entry);
+            auto capacity              = std::max(2 * static_cast<size_t>(_end - _begin), needed);
+            capacity                   = (capacity + granularity - 1) / granularity * granularity;
+            auto alloc    = get().allocate(capacity);
+            if(!alloc)
+                return nullptr;
+            auto * memory = static_cast<std::byte *>(alloc.ptr);
+            ::new(memory) block{alloc, _begin, _top, _end};
+            _begin = _top = memory + sizeof(block);
+            _end          = memory + alloc.size;
+            return fits(_top, _end);
+        }
+
+        // back to the previous block
+        void pop_block() noexcept
+        {
+            auto * b   = std::launder(reinterpret_cast<block *>(_begin - sizeof(block)));
+            auto alloc = b->allocation;
+            _begin     = b->previous_begin;
+            _top       = b->previous_top;
+            _end       = b->previous_end;
+            get().deallocate(alloc);
+        }
+
+        // drops everything without destroying the actions
+        void release() noexcept
+        {
+            while(_begin != _inline)
+                pop_block();
+            _top = _inline;
+        }
+
+        void unwind(bool run) noexcept
+        {
+            for(;;) {
+                if(_top == _begin) {
+                    if(_begin == _inline)
+                        break;
+                    pop_block();
+                    continue;
+                }
+                auto & e = *std::launder(reinterpret_cast<entry *>(_top - sizeof(entry)));
+                _top     = e.previous_top;
+                e.finish(e.object, run);
+            }
+            _trivial = true;
+        }
+
+        [[no_unique_address]] std::conditional_t<stateless, Alloc, Alloc *> _alloc{};
+        int _exceptions;
+        // all recorded actions are trivially destructible
+        bool _trivial = true;
+        alignas(std::max_align_t) std::byte _inline[Capacity];
+        // the current block
+        std::byte * _begin = _inline;
+        std::byte * _top   = _inline;
+        std::byte * _end   = _inline + Capacity;
+    };
+}
+
+#endif
@@ -0,0 +1,223 @@
+#include "bench/harness.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+namespace gstd::bench {
+    namespace {
+        [[nodiscard]] double median_of_sorted(std::vector<double> const & sorted) noexcept
+        {
+            auto n = sorted.size();
+            return n % 2 ? sorted[n / 2] : (sorted[n / 2 - 1] + sorted[n / 2]) / 2;
+        }
+
+        // `z` such that `confidence` of a standard normal distribution lies within [-z, z]
+        [[nodiscard]] double quantile_z(double confidence) noexcept
+        {
+            double low = 0, high = 10;
+            for(int i = 0; i < 64; ++i) {
+                auto mid = (low + high) / 2;
+                (std::erf(mid / std::sqrt(2.0)) < confidence ? low : high) = mid;
+            }
+            return low;
+        }
+
+        // 12.3ns, 4.56us, ...
+        [[nodiscard]] std::string pretty(double nanoseconds)
+        {
+            constexpr char const * units[]{"ns", "us", "ms", "s"};
+            size_t unit = 0;
+            for(; unit < 3 && std::abs(nanoseconds) >= 1000; ++unit)
+                nanoseconds /= 1000;
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.3g%s", nanoseconds, units[unit]);
+            return buffer;
+        }
+
+        // splits a line of the CSV written by `finish()` (names are quoted)
+        [[nodiscard]] std::vector<std::string> split_csv(std::string_view line)
+        {
+            std::vector<std::string> fields(1);
+            bool quoted = false;
+            for(size_t i = 0; i < line.size(); ++i) {
+                auto c = line[i];
+                if(quoted && c == '"' && i + 1 < line.size() && line[i + 1] == '"')
+                    fields.back() += line[++i];
+                else if(c == '"')
+                    quoted = !quoted;
+                else if(c == ',' && !quoted)
+                    fields.emplace_back();
+                else
+                    fields.back() += c;
+            }
+            return fields;
+        }
+
+        // names are always quoted, quotes doubled
+        void write_csv(std::ostream & os, std::string_view s)
+        {
+            os << '"';
+            for(auto c : s) {
+                if(c == '"')
+                    os << '"';
+                os << c;
+            }
+            os << '"';
+        }
+
+        void write_json(std::ostream & os, std::string_view s)
+        {
+            os << '"';
+            for(auto c : s) {
+                if(c == '"' || c == '\\')
+                    os << '\\';
+                os << c;
+            }
+            os << '"';
+        }
+    }
+
+    result analyze(std::string name, size_t iterations, std::vector<double> samples, double confidence)
+    {
+        std::ranges::sort(samples);
+        auto n      = samples.size();
+        auto median = median_of_sorted(samples);
+        std::vector<double> deviations(n);
+        std::ranges::transform(samples, deviations.begin(), [&](double x) { return std::abs(x - median); });
+        std::ranges::sort(deviations);
+        // the ranks around the median covering it with the given confidence (normal approximation of the binomial)
+        auto spread = quantile_z(confidence) * std::sqrt(static_cast<double>(n)) / 2;
+        auto low    = static_cast<size_t>(std::max(std::floor(static_cast<double>(n) / 2 - spread), 0.0));
+        auto high   = std::min(static_cast<size_t>(std::ceil(static_cast<double>(n) / 2 + spread)), n - 1);
+        return {
+          .name       = std::move(name),
+          .iterations = iterations,
+          .samples    = n,
+          .median     = median,
+          .mad        = median_of_sorted(deviations),
+          .ci_low     = samples[low],
+          .ci_high    = samples[high],
+          .min        = samples.front(),
+          .max        = samples.back(),
+          .ratio      = std::nullopt,
+        };
+    }
+
+    runner::runner(options opts) : _options{opts} { _options.samples = std::max(_options.samples, size_t{1}); }
+
+    runner::runner(int argc, char const * const * argv, options opts) : runner{opts}
+    {
+        for(int i = 1; i < argc; ++i) {
+            std::string_view arg = argv[i];
+            auto value           = [&](std::string_view option) {
+                return arg.starts_with(option) ? std::optional{arg.substr(option.size())} : std::nullopt;
+            };
+            if(auto f = value("--format=")) {
+                if(*f == "table")
+                    _format = format::table;
+                else if(*f == "csv")
+                    _format = format::csv;
+                else if(*f == "json")
+                    _format = format::json;
+                else
+                    throw std::invalid_argument{"unknown format: " + std::string{*f}};
+            } else if(auto path = value("--baseline=")) {
+                std::ifstream file{std::string{*path}};
+                std::string line;
+                if(!file || !std::getline(file, line))
+                    throw std::runtime_error{"can't read baseline: " + std::string{*path}};
+                auto header = split_csv(line);
+                auto column = [&](std::string_view name) {
+                    auto it = std::ranges::find(header, name);
+                    if(it == header.end())
+                        throw std::runtime_error{"baseline lacks column " + std::string{name}};
+                    return static_cast<size_t>(it - header.begin());
+                };
+                auto name = column("name"), median = column("median_ns");
+                auto low = column("ci_low_ns"), high = column("ci_high_ns");
+                while(std::getline(file, line)) {
+                    auto fields = split_csv(line);
+                    if(fields.size() != header.size())
+                        continue;
+                    result r{};
+                    r.name    = fields[name];
+                    r.median  = std::stod(fields[median]);
+                    r.ci_low  = std::stod(fields[low]);
+                    r.ci_high = std::stod(fields[high]);
+                    _baseline.insert_or_assign(r.name, std::move(r));
+                }
+            } else if(auto filter = value("--filter=")) {
+                _filter = *filter;
+            } else if(auto samples = value("--samples=")) {
+                _options.samples = std::max(static_cast<size_t>(std::stoull(std::string{*samples})), size_t{1});
+            } else {
+                throw std::invalid_argument{"unknown argument: " + std::string{arg}};
+            }
+        }
+    }
+
+    bool runner::selected(std::string_view name) const noexcept
+    {
+        return name.find(_filter) != std::string_view::npos;
+    }
+
+    void runner::record(result r)
+    {
+        if(auto it = _baseline.find(r.name); it != _baseline.end()) {
+            auto & base   = it->second;
+            r.ratio       = r.median / base.median;
+            r.significant = r.ci_high < base.ci_low || base.ci_high < r.ci_low;
+        }
+        if(_format == format::table) {
+            if(_results.empty())
+                std::printf("%-40s %10s %10s %23s %12s\n", "benchmark", "median", "mad", "confidence interval",
+                            "iterations");
+            auto interval = "[" + pretty(r.ci_low) + ", " + pretty(r.ci_high) + "]";
+            std::printf("%-40s %10s %10s %23s %7zu x %-3zu", r.name.c_str(), pretty(r.median).c_str(),
+                        pretty(r.mad).c_str(), interval.c_str(), r.iterations, r.samples);
+            if(r.ratio)
+                std::printf(" %+6.1f%%%s", (*r.ratio - 1) * 100, r.significant ? "" : " (insignificant)");
+            std::printf("\n");
+            std::fflush(stdout);
+        }
+        _results.push_back(std::move(r));
+    }
+
+    int runner::finish()
+    {
+        auto & os = std::cout;
+        if(_format == format::csv) {
+            os << "name,iterations,samples,median_ns,mad_ns,ci_low_ns,ci_high_ns,min_ns,max_ns,baseline_ratio\n";
+            for(auto & r : _results) {
+                write_csv(os, r.name);
+                os << ',' << r.iterations << ',' << r.samples << ',' << r.median << ',' << r.mad << ',' << r.ci_low
+                   << ',' << r.ci_high << ',' << r.min << ',' << r.max << ',';
+                if(r.ratio)
+                    os << *r.ratio;
+                os << '\n';
+            }
+        } else if(_format == format::json) {
+            os << "{\"benchmarks\":[";
+            for(size_t i = 0; i < _results.size(); ++i) {
+                auto & r = _results[i];
+                os << (i ? ",\n" : "\n") << "{\"name\":";
+                write_json(os, r.name);
+                os << ",\"iterations\":" << r.iterations << ",\"samples\":" << r.samples << ",\"median_ns\":"
+                   << r.median << ",\"mad_ns\":" << r.mad << ",\"ci_low_ns\":" << r.ci_low << ",\"ci_high_ns\":"
+                   << r.ci_high << ",\"min_ns\":" << r.min << ",\"max_ns\":" << r.max;
+                if(r.ratio) {
+                    os << ",\"baseline_ratio\":" << *r.ratio
+                       << ",\"significant\":" << (r.significant ? "true" : "false");
+                }
+                os << '}';
+            }
+            os << "\n]}\n";
+        }
+        os.flush();
+        return os ? 0 : 1;
+    }
+}
@@ -0,0 +1,62 @@
+#include "io/byte_ring.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "utility/scope_guards.hpp"
+
+namespace gstd::io {
+    namespace {
+        [[noreturn]] void fail(char const * what)
+        {
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+    }
+
+    // reserves twice the capacity of address space and maps the same shared memory file over both halves, so byte
+    // `i + capacity` is byte `i`
+    byte_ring::byte_ring(size_t capacity)
+    {
+        auto page = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        capacity  = std::max((capacity + page - 1) / page * page, page);
+        int fd    = ::memfd_create("gstd::io::byte_ring", MFD_CLOEXEC);
+        if(fd < 0)
+            fail("memfd_create");
+        // the mappings keep the memory alive
+        GSTD_SCOPE_EXIT += [fd] { ::close(fd); };
+        if(::ftruncate(fd, static_cast<off_t>(capacity)) < 0)
+            fail("ftruncate");
+        auto * reserved = ::mmap(nullptr, 2 * capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(reserved == MAP_FAILED)
+            fail("mmap");
+        auto * base = static_cast<char *>(reserved);
+        for(auto * half : {base, base + capacity}) {
+            if(::mmap(half, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+                auto error = errno;
+                ::munmap(base, 2 * capacity);
+                errno = error;
+                fail("mmap");
+            }
+        }
+        _data     = base;
+        _capacity = capacity;
+    }
+
+    byte_ring::~byte_ring()
+    {
+        if(_data)
+            ::munmap(_data, 2 * _capacity);
+    }
+
+    size_t byte_ring::write(void const * bytes, size_t size) noexcept
+    {
+        auto n = std::min(size, _capacity - _size);
+        if(n)
+            std::memcpy(end(), bytes, n);
+        _size += n;
+        return n;
+    }
+}
@@ -1,10 +1,10 @@
-#include "time.hpp"
+#include "time/debug_timer.hpp"
 
 #include <iostream>
 
 namespace gstd::time {
     debug_timer::debug_timer(char const * name) noexcept
-        : _name{name}, _start_time{std::chrono::high_resolution_clock::now()}
+        : _name{name}, _start_time{tsc_clock::now()}
     {}
 
     debug_timer::~debug_timer()
@@ -15,10 +15,12 @@ namespace gstd::time {
 
     void debug_timer::display() const
     {
-        auto end_time = std::chrono::high_resolution_clock::now();
-        auto elapsed  = end_time - _start_time;
-        std::cout << "\27[2K\r"                                         // clear entire line and return
-                  << (_name ? _name : "debug_timer") << ": " << elapsed // print name and elapsed time
-                  << std::flush;                                        // flush stream so output is shown
+        std::cout << "\27[2K\r"           // clear entire line and return
+                  << *this << std::flush; // flush stream so output is shown
+    }
+
+    std::ostream & operator<<(std::ostream & os, debug_timer const & timer)
+    {
+        return os << (timer._name ? timer._name : "debug_timer") << ": " << tsc_clock::now() - timer._start_time;
     }
 }
@@ -0,0 +1,95 @@
+#include "allocation/epoch.hpp"
+
+#include <utility>
+
+namespace gstd::allocation::_impl::epoch {
+    namespace {
+        namespace thread_slots = utility::_impl::thread_slots;
+
+        // hands an exiting thread's participant to the next thread to join
+        void release(void *, void * self) noexcept
+        {
+            static_cast<participant *>(self)->owned.store(false, std::memory_order_release);
+        }
+    }
+
+    domain_base::domain_base(deallocate_fn deallocate)
+        : _id{thread_slots::new_id()}, _deallocate{deallocate}
+    {}
+
+    domain_base::~domain_base()
+    {
+        thread_slots::retire(_id);
+        for(auto * p = _participants.load(std::memory_order_acquire); p;)
+            delete std::exchange(p, p->next);
+    }
+
+    void domain_base::clear() noexcept
+    {
+        for(auto * p = _participants.load(std::memory_order_acquire); p; p = p->next)
+            for(auto & list : p->lists)
+                free(list);
+    }
+
+    void domain_base::free(limbo & list) noexcept
+    {
+        for(auto block : list.blocks) {
+            if(block.destroy)
+                block.destroy(block.ptr);
+            _deallocate(*this, {block.ptr, block.size});
+        }
+        list.blocks.clear();
+    }
+
+    void domain_base::retire(participant & self, retired block)
+    {
+        auto epoch  = _epoch.load(std::memory_order_seq_cst);
+        auto & list = self.lists[epoch % 3];
+        // anything in there was retired at least three epochs ago
+        if(list.epoch != epoch) {
+            free(list);
+            list.epoch = epoch;
+        }
+        list.blocks.push_back(block);
+        if(++self.retired >= collect_interval)
+            collect(self);
+    }
+
+    void domain_base::collect(participant & self) noexcept
+    {
+        self.retired = 0;
+        auto epoch   = _epoch.load(std::memory_order_seq_cst);
+        bool behind  = false;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        for(auto * p = _participants.load(std::memory_order_acquire); p && !behind; p = p->next) {
+            auto state = p->state.load(std::memory_order_acquire);
+            behind     = (state & 1) && state >> 1 != epoch;
+        }
+        // pairs with the fence in `enter`, another thread may have advanced it already
+        if(!behind && _epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst))
+            ++epoch;
+        for(auto & list : self.lists)
+            if(list.epoch + 2 <= epoch)
+                free(list);
+    }
+
+    participant & domain_base::add_participant()
+    {
+        // before a participant is taken, which couldn't be given back otherwise
+        thread_slots::reserve(_id);
+        participant * self = nullptr;
+        // takes over the participant of an exited thread, including its retired blocks
+        for(auto * p = _participants.load(std::memory_order_acquire); p && !self; p = p->next) {
+            bool owned = false;
+            if(p->owned.compare_exchange_strong(owned, true, std::memory_order_acquire))
+                self = p;
+        }
+        if(!self) {
+            self       = new participant;
+            self->next = _participants.load(std::memory_order_relaxed);
+            while(!_participants.compare_exchange_weak(self->next, self, std::memory_order_release)) {}
+        }
+        thread_slots::set(_id, self, &release);
+        return *self;
+    }
+}
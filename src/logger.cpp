@@ -0,0 +1,154 @@
+#include "time/logger.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+namespace gstd::time {
+    namespace {
+        namespace thread_slots = utility::_impl::thread_slots;
+
+        void format(std::string & out, _impl::logging::record const & r)
+        {
+            char digits[24];
+            auto elapsed = tsc_clock::to_duration(static_cast<std::int64_t>(r.ticks)).count();
+            auto end     = std::to_chars(digits, digits + sizeof(digits), elapsed).ptr;
+            out.append(r.name ? r.name : "logging_timer").append(": ").append(digits, end).append("ns\n");
+        }
+    }
+
+    sink ostream_sink(std::ostream & os)
+    {
+        return [&os](std::string_view batch) {
+            os.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            os.flush();
+        };
+    }
+
+    sink fd_sink(int fd)
+    {
+        return [fd](std::string_view batch) {
+            while(!batch.empty()) {
+                auto written = ::write(fd, batch.data(), batch.size());
+                if(written < 0) {
+                    if(errno == EINTR)
+                        continue;
+                    return;
+                }
+                batch.remove_prefix(static_cast<size_t>(written));
+            }
+        };
+    }
+
+    sink file_sink(char const * path)
+    {
+        std::shared_ptr<std::FILE> file{std::fopen(path, "a"), [](std::FILE * f) { std::fclose(f); }};
+        if(!file)
+            throw std::system_error{errno, std::generic_category(), path};
+        return [file = std::move(file)](std::string_view batch) {
+            std::fwrite(batch.data(), 1, batch.size(), file.get());
+            std::fflush(file.get());
+        };
+    }
+
+    struct logger::state {
+        // formats everything pushed so far and writes it in one go
+        void drain()
+        {
+            {
+                std::lock_guard lock{mutex};
+                for(auto & e : rings) {
+                    auto n = e.ring->try_pop_n(batch, _impl::logging::ring_capacity);
+                    for(size_t i = 0; i < n; ++i)
+                        format(buffer, batch[i]);
+                }
+                // nothing is pushed after a thread exits, so its ring was just emptied
+                std::erase_if(rings, [](auto & e) { return e.exited; });
+            }
+            if(!buffer.empty()) {
+                out(buffer);
+                buffer.clear();
+            }
+        }
+
+        void run()
+        {
+            std::unique_lock lock{stop_mutex};
+            while(!wakeup.wait_for(lock, interval, [this] { return stop; })) {
+                lock.unlock();
+                drain();
+                lock.lock();
+            }
+            lock.unlock();
+            drain();
+        }
+
+        sink out;
+        std::chrono::milliseconds interval;
+        struct entry {
+            std::unique_ptr<_impl::logging::ring> ring;
+            // its thread has exited
+            bool exited = false;
+        };
+
+        // guards `rings`
+        std::mutex mutex;
+        std::vector<entry> rings;
+        // only used by the background thread, a whole ring is popped at once
+        std::string buffer;
+        _impl::logging::record batch[_impl::logging::ring_capacity];
+        std::mutex stop_mutex;
+        std::condition_variable wakeup;
+        bool stop = false;
+        std::thread thread;
+    };
+
+    logger::logger(sink out, std::chrono::milliseconds interval)
+        : _id{thread_slots::new_id()}, _state{std::make_unique<state>()}
+    {
+        _state->out      = std::move(out);
+        _state->interval = interval;
+        _state->thread   = std::thread{[this] { _state->run(); }};
+    }
+
+    logger::~logger()
+    {
+        thread_slots::retire(_id);
+        {
+            std::lock_guard lock{_state->stop_mutex};
+            _state->stop = true;
+        }
+        _state->wakeup.notify_one();
+        _state->thread.join();
+    }
+
+    _impl::logging::ring & logger::add_ring()
+    {
+        thread_slots::reserve(_id);
+        auto owned = std::make_unique<_impl::logging::ring>(_impl::logging::ring_capacity);
+        auto * ring = owned.get();
+        {
+            std::lock_guard lock{_state->mutex};
+            _state->rings.push_back({std::move(owned)});
+        }
+        thread_slots::set(_id, ring, &release, _state.get());
+        return *ring;
+    }
+
+    void logger::release(void * self, void * ring) noexcept
+    {
+        auto & s = *static_cast<state *>(self);
+        std::lock_guard lock{s.mutex};
+        for(auto & e : s.rings)
+            if(e.ring.get() == ring)
+                e.exited = true;
+    }
+}
@@ -0,0 +1,70 @@
+#include "io/mapped_file.hpp"
+
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "utility/scope_guards.hpp"
+
+namespace gstd::io {
+    namespace {
+        int to_native(advice hint) noexcept
+        {
+            switch(hint) {
+            case advice::sequential: return MADV_SEQUENTIAL;
+            case advice::random: return MADV_RANDOM;
+            case advice::will_need: return MADV_WILLNEED;
+            case advice::dont_need: return MADV_DONTNEED;
+            default: return MADV_NORMAL;
+            }
+        }
+
+        [[noreturn]] void fail(char const * what)
+        {
+            throw std::system_error{errno, std::generic_category(), what};
+        }
+    }
+
+    mapped_file::mapped_file(char const * path, advice hint)
+    {
+        int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if(fd < 0)
+            fail(path);
+        GSTD_SCOPE_EXIT += [fd] { ::close(fd); };
+        struct stat info;
+        if(::fstat(fd, &info) < 0)
+            fail(path);
+        // mapping nothing fails, an empty file is an empty range
+        if(info.st_size == 0)
+            return;
+        auto size = static_cast<size_t>(info.st_size);
+        auto * ptr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(ptr == MAP_FAILED)
+            fail(path);
+        _data = static_cast<char const *>(ptr);
+        _size = size;
+        if(hint != advice::normal)
+            advise(hint);
+    }
+
+    mapped_file::~mapped_file()
+    {
+        if(_data)
+            ::munmap(const_cast<char *>(_data), _size);
+    }
+
+    void mapped_file::advise(advice hint, size_t offset, size_t length) const noexcept
+    {
+        if(offset >= _size)
+            return;
+        if(length > _size - offset)
+            length = _size - offset;
+        // the start has to be page-aligned
+        auto page  = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        auto start = offset / page * page;
+        // advice is best-effort, failures are ignored
+        ::madvise(const_cast<char *>(_data) + start, length + (offset - start), to_native(hint));
+    }
+}
@@ -0,0 +1,109 @@
+#include "time/metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+namespace gstd::time {
+    namespace {
+        namespace thread_slots = utility::_impl::thread_slots;
+    }
+
+    histogram::histogram() : _counts{std::make_unique<std::atomic<std::uint64_t>[]>(buckets)} {}
+
+    void histogram::merge(histogram const & other) noexcept
+    {
+        std::uint64_t total = 0;
+        for(size_t i = 0; i < buckets; ++i) {
+            auto n = other._counts[i].load(std::memory_order_relaxed);
+            increment(_counts[i], n);
+            total += n;
+        }
+        // consistent with the buckets even if `other` was written in the meantime
+        increment(_count, total);
+        auto m = other.max();
+        if(m > max())
+            _max.store(m, std::memory_order_relaxed);
+    }
+
+    std::uint64_t histogram::quantile(double q) const noexcept
+    {
+        auto total = count();
+        if(!total)
+            return 0;
+        auto target = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(total)));
+        target      = std::max(target, std::uint64_t{1});
+        std::uint64_t seen = 0;
+        for(size_t i = 0; i < buckets; ++i) {
+            seen += _counts[i].load(std::memory_order_relaxed);
+            if(seen >= target)
+                return std::min(highest(i), max());
+        }
+        return max();
+    }
+
+    std::ostream & operator<<(std::ostream & os, summary const & s)
+    {
+        return os << s.name << ": " << s.count << " p50 " << s.p50 << " p99 " << s.p99 << " p99.9 " << s.p999
+                  << " max " << s.max;
+    }
+
+    metrics::metric::metric(std::string name)
+        : _name{std::move(name)}, _id{thread_slots::new_id()}
+    {}
+
+    metrics::metric::~metric() { thread_slots::retire(_id); }
+
+    histogram & metrics::metric::add_shard()
+    {
+        thread_slots::reserve(_id);
+        histogram * shard;
+        {
+            std::lock_guard lock{_mutex};
+            shard = _shards.emplace_back(std::make_unique<histogram>()).get();
+        }
+        thread_slots::set(_id, shard, &release, this);
+        return *shard;
+    }
+
+    void metrics::metric::release(void * self, void * shard) noexcept
+    {
+        auto & m = *static_cast<metric *>(self);
+        std::lock_guard lock{m._mutex};
+        auto it = std::ranges::find(m._shards, shard, [](auto & s) { return static_cast<void *>(s.get()); });
+        m._exited.merge(**it);
+        m._shards.erase(it);
+    }
+
+    summary metrics::metric::report() const
+    {
+        histogram merged;
+        {
+            std::lock_guard lock{_mutex};
+            merged.merge(_exited);
+            for(auto & shard : _shards)
+                merged.merge(*shard);
+        }
+        auto at = [&](double q) { return tsc_clock::duration{static_cast<tsc_clock::rep>(merged.quantile(q))}; };
+        return {_name, merged.count(), at(0.5), at(0.99), at(0.999), at(1)};
+    }
+
+    metrics::metric & metrics::operator[](std::string_view name)
+    {
+        std::lock_guard lock{_mutex};
+        auto it = _metrics.find(name);
+        if(it == _metrics.end())
+            it = _metrics.emplace(std::string{name}, std::make_unique<metric>(std::string{name})).first;
+        return *it->second;
+    }
+
+    std::vector<summary> metrics::report() const
+    {
+        std::lock_guard lock{_mutex};
+        std::vector<summary> summaries;
+        summaries.reserve(_metrics.size());
+        for(auto & [name, m] : _metrics)
+            summaries.push_back(m->report());
+        return summaries;
+    }
+}
@@ -0,0 +1,149 @@
+#include "time/perf_counters.hpp"
+
+#include <ostream>
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace gstd::time {
+    namespace {
+        constexpr char const * names[counter_count]{
+          "cycles",
+          "instructions",
+          "cache-misses",
+          "branch-misses",
+          "llc-misses",
+        };
+
+#if defined(__linux__)
+        perf_event_attr attributes(counter c) noexcept
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size           = sizeof(attr);
+            attr.type           = PERF_TYPE_HARDWARE;
+            attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv     = 1;
+            switch(c) {
+            case counter::cycles: attr.config = PERF_COUNT_HW_CPU_CYCLES; break;
+            case counter::instructions: attr.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+            case counter::cache_misses: attr.config = PERF_COUNT_HW_CACHE_MISSES; break;
+            case counter::branch_misses: attr.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+            case counter::llc_misses:
+                attr.type   = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                              | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            }
+            return attr;
+        }
+
+        int open(perf_event_attr & attr, int leader) noexcept
+        {
+            return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, leader, PERF_FLAG_FD_CLOEXEC));
+        }
+#endif
+    }
+
+    std::optional<double> perf_sample::ipc() const noexcept
+    {
+        auto cycles       = (*this)[counter::cycles];
+        auto instructions = (*this)[counter::instructions];
+        if(!cycles || !instructions || !*cycles)
+            return std::nullopt;
+        return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+    }
+
+    perf_sample operator-(perf_sample const & lhs, perf_sample const & rhs) noexcept
+    {
+        perf_sample difference;
+        difference.available = lhs.available & rhs.available;
+        difference.time      = lhs.time - rhs.time;
+        for(size_t i = 0; i < counter_count; ++i)
+            if(difference.available[i])
+                difference.values[i] = lhs.values[i] - rhs.values[i];
+        return difference;
+    }
+
+    perf_sample & perf_sample::operator+=(perf_sample const & rhs) noexcept
+    {
+        available |= rhs.available;
+        time += rhs.time;
+        for(size_t i = 0; i < counter_count; ++i)
+            values[i] += rhs.values[i];
+        return *this;
+    }
+
+    std::ostream & operator<<(std::ostream & os, perf_sample const & s)
+    {
+        os << s.time;
+        for(size_t i = 0; i < counter_count; ++i)
+            if(s.available[i])
+                os << ' ' << names[i] << ' ' << s.values[i];
+        if(auto ipc = s.ipc())
+            os << " ipc " << *ipc;
+        return os;
+    }
+
+    perf_counter_group::perf_counter_group() noexcept
+    {
+        _fds.fill(-1);
+#if defined(__linux__)
+        size_t opened = 0;
+        for(size_t i = 0; i < counter_count; ++i) {
+            auto c    = static_cast<counter>(i);
+            auto attr = attributes(c);
+            // only the leader starts disabled, the others follow it
+            attr.disabled = _leader < 0;
+            auto fd       = open(attr, _leader);
+            if(fd < 0)
+                continue;
+            if(_leader < 0)
+                _leader = fd;
+            _fds[i]          = fd;
+            _order[opened++] = c;
+            _available[i]    = true;
+        }
+        if(_leader >= 0)
+            ::ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    perf_counter_group::~perf_counter_group()
+    {
+#if defined(__linux__)
+        for(auto fd : _fds)
+            if(fd >= 0)
+                ::close(fd);
+#endif
+    }
+
+    perf_sample perf_counter_group::read() const noexcept
+    {
+        perf_sample s;
+        s.time = tsc_clock::now().time_since_epoch();
+#if defined(__linux__)
+        // number of counters, time enabled, time running, values
+        std::uint64_t data[3 + counter_count];
+        if(_leader < 0 || ::read(_leader, data, sizeof(data)) < static_cast<ssize_t>(3 * sizeof(std::uint64_t)))
+            return s;
+        auto enabled = data[1], running = data[2];
+        for(size_t i = 0; i < data[0] && i < counter_count; ++i) {
+            auto value = data[3 + i];
+            // extrapolated while multiplexed with other groups
+            if(running && running < enabled)
+                value = static_cast<std::uint64_t>(static_cast<double>(value) * static_cast<double>(enabled)
+                                                   / static_cast<double>(running));
+            auto c         = static_cast<size_t>(_order[i]);
+            s.values[c]    = value;
+            s.available[c] = true;
+        }
+#endif
+        return s;
+    }
+}
@@ -0,0 +1,304 @@
+#include "coroutine/scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <queue>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+#include "work_deque.hpp"
+
+namespace gstd::coroutine {
+    namespace {
+        struct worker {
+            void const * sched;
+            parallel::_impl::work_deque<void> deque;
+            std::uint64_t seed;
+            std::thread thread;
+        };
+
+        // the worker the calling thread is (if any)
+        thread_local worker * current = nullptr;
+
+        // injected coroutines taken at once, the rest of them is left for the other workers
+        constexpr size_t injected_batch = 32;
+
+        [[noreturn]] void fail(char const * what) { throw std::system_error{errno, std::generic_category(), what}; }
+
+        void resume(void * address) noexcept { std::coroutine_handle<>::from_address(address).resume(); }
+
+        // closes the file descriptor it owns (if any)
+        class descriptor {
+          public:
+            explicit descriptor(int fd) noexcept : _fd{fd} {}
+
+            descriptor(descriptor const &)             = delete;
+            descriptor & operator=(descriptor const &) = delete;
+
+            ~descriptor()
+            {
+                if(_fd >= 0)
+                    ::close(_fd);
+            }
+
+            [[nodiscard]] operator int() const noexcept { return _fd; }
+          private:
+            int _fd;
+        };
+    }
+
+    struct scheduler::state {
+        using timer = std::pair<clock::time_point, void *>;
+
+        state()
+            : epoll{::epoll_create1(EPOLL_CLOEXEC)}, wakeup{::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)}
+            , timers_fd{::timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK)}
+        {
+            // the descriptors already opened are closed by their owners if any of this throws
+            if(epoll < 0)
+                fail("epoll_create1");
+            if(wakeup < 0)
+                fail("eventfd");
+            if(timers_fd < 0)
+                fail("timerfd_create");
+            // the event's `ptr` tells them apart from `fd_awaiter`s
+            epoll_event event{.events = EPOLLIN, .data = {.ptr = &wakeup}};
+            if(::epoll_ctl(epoll, EPOLL_CTL_ADD, wakeup, &event) < 0)
+                fail("epoll_ctl");
+            event.data.ptr = &timers_fd;
+            if(::epoll_ctl(epoll, EPOLL_CTL_ADD, timers_fd, &event) < 0)
+                fail("epoll_ctl");
+        }
+
+        [[nodiscard]] void * find_work(worker & self) noexcept
+        {
+            if(auto * h = self.deque.pop())
+                return h;
+            // steal from a random victim onwards
+            self.seed  = self.seed * 6364136223846793005u + 1442695040888963407u;
+            auto n     = workers.size();
+            auto first = static_cast<size_t>(self.seed >> 33) % n;
+            for(size_t i = 0; i < n; ++i) {
+                auto & victim = *workers[(first + i) % n];
+                if(&victim != &self)
+                    if(auto * h = victim.deque.steal())
+                        return h;
+            }
+            if(!injected_count.load(std::memory_order_acquire))
+                return nullptr;
+            std::lock_guard lock{mutex};
+            if(injected.empty())
+                return nullptr;
+            // keeps one and pushes the others onto its own deque (where they can be stolen)
+            auto take = std::min(injected.size(), injected_batch);
+            auto * h  = injected.front();
+            injected.pop_front();
+            for(size_t i = 1; i < take; ++i) {
+                self.deque.push(injected.front());
+                injected.pop_front();
+            }
+            injected_count.fetch_sub(take, std::memory_order_relaxed);
+            if(take > 1)
+                signal(1);
+            return h;
+        }
+
+        // wakes up to `n` sleeping workers after new work has been published
+        void signal(size_t n) noexcept
+        {
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            auto asleep = sleeping.load(std::memory_order_seq_cst);
+            if(!asleep)
+                return;
+            if(n >= asleep) {
+                epoch.notify_all();
+            } else {
+                for(size_t i = 0; i < n; ++i)
+                    epoch.notify_one();
+            }
+        }
+
+        // hands coroutines made ready outside of the workers to them, under a single lock
+        void inject(std::vector<void *> const & ready)
+        {
+            if(ready.empty())
+                return;
+            {
+                std::lock_guard lock{mutex};
+                injected.insert(injected.end(), ready.begin(), ready.end());
+                injected_count.fetch_add(ready.size(), std::memory_order_release);
+            }
+            signal(ready.size());
+        }
+
+        void work_loop(worker & self) noexcept
+        {
+            current = &self;
+            for(;;) {
+                if(auto * h = find_work(self)) {
+                    resume(h);
+                    continue;
+                }
+                // spin briefly before going to sleep
+                void * h = nullptr;
+                for(int spin = 0; spin < 64 && !h; ++spin) {
+                    std::this_thread::yield();
+                    h = find_work(self);
+                }
+                if(h) {
+                    resume(h);
+                    continue;
+                }
+                sleeping.fetch_add(1, std::memory_order_seq_cst);
+                auto e = epoch.load(std::memory_order_seq_cst);
+                if(stop.load(std::memory_order_seq_cst)) {
+                    sleeping.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+                h = find_work(self);
+                if(!h)
+                    epoch.wait(e, std::memory_order_seq_cst);
+                sleeping.fetch_sub(1, std::memory_order_relaxed);
+                if(h)
+                    resume(h);
+            }
+        }
+
+        void arm_timer(clock::time_point deadline) noexcept
+        {
+            auto since_epoch = std::max(deadline.time_since_epoch(), clock::duration{1});
+            auto seconds     = std::chrono::duration_cast<std::chrono::seconds>(since_epoch);
+            itimerspec spec{};
+            spec.it_value.tv_sec  = static_cast<time_t>(seconds.count());
+            spec.it_value.tv_nsec = static_cast<long>(std::chrono::nanoseconds{since_epoch - seconds}.count());
+            ::timerfd_settime(timers_fd, TFD_TIMER_ABSTIME, &spec, nullptr);
+        }
+
+        // every coroutine made ready by a single `epoll_wait` is injected at once
+        void reactor_loop() noexcept
+        {
+            epoll_event events[64];
+            std::vector<void *> ready;
+            for(;;) {
+                int n = ::epoll_wait(epoll, events, 64, -1);
+                if(n < 0)
+                    continue; // EINTR
+                ready.clear();
+                for(int i = 0; i < n; ++i) {
+                    auto * ptr = events[i].data.ptr;
+                    std::uint64_t count;
+                    if(ptr == &wakeup) {
+                        [[maybe_unused]] auto _ = ::read(wakeup, &count, sizeof(count));
+                        if(stop.load(std::memory_order_seq_cst))
+                            return;
+                    } else if(ptr == &timers_fd) {
+                        [[maybe_unused]] auto _ = ::read(timers_fd, &count, sizeof(count));
+                        std::lock_guard lock{timers_mutex};
+                        auto now = clock::now();
+                        while(!timers.empty() && timers.top().first <= now) {
+                            ready.push_back(timers.top().second);
+                            timers.pop();
+                        }
+                        if(!timers.empty())
+                            arm_timer(timers.top().first);
+                    } else {
+                        auto & waiter = *static_cast<fd_awaiter *>(ptr);
+                        // removed before the coroutine (and with it `waiter`) can go away
+                        ::epoll_ctl(epoll, EPOLL_CTL_DEL, waiter.fd, nullptr);
+                        ready.push_back(waiter.coro.address());
+                    }
+                }
+                inject(ready);
+            }
+        }
+
+        std::vector<std::unique_ptr<worker>> workers;
+        std::mutex mutex;
+        std::deque<void *> injected;
+        std::atomic<size_t> injected_count{0};
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<size_t> sleeping{0};
+        std::atomic<bool> stop{false};
+
+        descriptor epoll;
+        descriptor wakeup;
+        descriptor timers_fd;
+        std::mutex timers_mutex;
+        std::priority_queue<timer, std::vector<timer>, std::greater<>> timers;
+        std::thread reactor;
+    };
+
+    scheduler::scheduler(size_t threads) : _state{std::make_unique<state>()}
+    {
+        if(threads == 0)
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        auto & workers = _state->workers;
+        workers.reserve(threads);
+        for(size_t i = 0; i < threads; ++i)
+            workers.emplace_back(std::make_unique<worker>(_state.get())).get()->seed = i + 1;
+        // workers only start once all deques exist
+        for(auto & w : workers)
+            w->thread = std::thread{[this, &self = *w] { _state->work_loop(self); }};
+        _state->reactor = std::thread{[this] { _state->reactor_loop(); }};
+    }
+
+    scheduler::~scheduler()
+    {
+        _state->stop.store(true, std::memory_order_seq_cst);
+        std::uint64_t one = 1;
+        [[maybe_unused]] auto _ = ::write(_state->wakeup, &one, sizeof(one));
+        _state->reactor.join();
+        _state->epoch.fetch_add(1, std::memory_order_seq_cst);
+        _state->epoch.notify_all();
+        for(auto & w : _state->workers)
+            w->thread.join();
+    }
+
+    size_t scheduler::size() const noexcept { return _state->workers.size(); }
+
+    scheduler::fd_awaiter scheduler::readable(int fd) noexcept { return {this, fd, EPOLLIN | EPOLLRDHUP, {}}; }
+
+    scheduler::fd_awaiter scheduler::writable(int fd) noexcept { return {this, fd, EPOLLOUT, {}}; }
+
+    void scheduler::spawn(task<void> t)
+    {
+        [](scheduler & self, task<void> t) -> _impl::scheduler::detached {
+            co_await self.schedule();
+            co_await std::move(t);
+        }(*this, std::move(t));
+    }
+
+    void scheduler::post(std::coroutine_handle<> h)
+    {
+        if(current && current->sched == _state.get()) {
+            current->deque.push(h.address());
+            _state->signal(1);
+        } else {
+            _state->inject({h.address()});
+        }
+    }
+
+    void scheduler::add_timer(clock::time_point deadline, std::coroutine_handle<> h)
+    {
+        std::lock_guard lock{_state->timers_mutex};
+        auto & timers = _state->timers;
+        if(timers.empty() || deadline < timers.top().first)
+            _state->arm_timer(deadline);
+        timers.emplace(deadline, h.address());
+    }
+
+    void scheduler::add_waiter(fd_awaiter & waiter)
+    {
+        epoll_event event{.events = waiter.events | EPOLLONESHOT, .data = {.ptr = &waiter}};
+        if(::epoll_ctl(_state->epoll, EPOLL_CTL_ADD, waiter.fd, &event) < 0)
+            fail("epoll_ctl");
+    }
+}
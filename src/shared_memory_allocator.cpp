@@ -0,0 +1,178 @@
+#include "allocation/shared_memory_allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <new>
+#include <system_error>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "utility/scope_guards.hpp"
+
+namespace gstd::allocation {
+    namespace {
+        // free list heads pack the offset of the first block (0 if empty) with a tag counting every change
+        constexpr unsigned offset_bits       = 40;
+        constexpr std::uint64_t offset_mask  = (std::uint64_t{1} << offset_bits) - 1;
+        constexpr unsigned min_block_bits    = 4;
+        constexpr size_t size_classes        = offset_bits - min_block_bits + 1;
+        constexpr std::uint64_t magic_number = 0x67'73'74'64'73'68'6d'31; // "gstdshm1"
+
+        // atomics in the region are shared by processes, which only works for lock-free ones
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+        [[noreturn]] void fail(char const * what, int error = errno)
+        {
+            throw std::system_error{error, std::generic_category(), what};
+        }
+
+        [[nodiscard]] size_t size_class(size_t size) noexcept
+        {
+            return static_cast<size_t>(std::bit_width(std::max(size, size_t{1} << min_block_bits) - 1))
+                   - min_block_bits;
+        }
+
+        // at the start of the region, everything in it is an offset from there
+        struct header {
+            std::atomic<std::uint64_t> magic;
+            std::uint64_t size;
+            // start of the never allocated rest
+            std::atomic<std::uint64_t> top;
+            std::atomic<std::uint64_t> root;
+            std::atomic<std::uint64_t> free[size_classes];
+        };
+
+        // blocks of 64 bytes and more are cache-line aligned, smaller ones are aligned to their size
+        constexpr size_t header_size = (sizeof(header) + 63) / 64 * 64;
+
+        [[nodiscard]] header & get(char * data) noexcept { return *std::launder(reinterpret_cast<header *>(data)); }
+
+        [[nodiscard]] std::uint64_t retag(std::uint64_t head, std::uint64_t offset) noexcept
+        {
+            return ((head >> offset_bits) + 1) << offset_bits | offset;
+        }
+    }
+
+    shared_memory_allocator::shared_memory_allocator(char const * name, size_t size)
+    {
+        if(size < header_size || size > offset_mask)
+            fail(name, EINVAL);
+        int fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+        if(fd < 0)
+            fail(name);
+        GSTD_SCOPE_EXIT += [fd] { ::close(fd); };
+        auto * ptr = ::ftruncate(fd, static_cast<off_t>(size)) < 0
+                       ? MAP_FAILED
+                       : ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if(ptr == MAP_FAILED) {
+            auto error = errno;
+            ::shm_unlink(name);
+            fail(name, error);
+        }
+        _data     = static_cast<char *>(ptr);
+        _size     = size;
+        _writable = true;
+        // the object is zero-filled, ie. all free lists are empty
+        auto & h = *::new(ptr) header{};
+        h.size   = size;
+        h.top.store(header_size, std::memory_order_relaxed);
+        h.magic.store(magic_number, std::memory_order_release);
+    }
+
+    shared_memory_allocator::shared_memory_allocator(char const * name, shared_access access)
+    {
+        bool writable = access == shared_access::read_write;
+        int fd        = ::shm_open(name, (writable ? O_RDWR : O_RDONLY) | O_CLOEXEC, 0);
+        if(fd < 0)
+            fail(name);
+        GSTD_SCOPE_EXIT += [fd] { ::close(fd); };
+        struct stat info;
+        if(::fstat(fd, &info) < 0)
+            fail(name);
+        auto size = static_cast<size_t>(info.st_size);
+        if(size < header_size)
+            fail(name, EINVAL);
+        auto * ptr = ::mmap(nullptr, size, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+        if(ptr == MAP_FAILED)
+            fail(name);
+        auto & h = get(static_cast<char *>(ptr));
+        if(h.magic.load(std::memory_order_acquire) != magic_number || h.size != size) {
+            ::munmap(ptr, size);
+            fail(name, EINVAL);
+        }
+        _data     = static_cast<char *>(ptr);
+        _size     = size;
+        _writable = writable;
+    }
+
+    shared_memory_allocator::~shared_memory_allocator()
+    {
+        if(_data)
+            ::munmap(_data, _size);
+    }
+
+    bool shared_memory_allocator::remove(char const * name) noexcept { return ::shm_unlink(name) == 0; }
+
+    // the first 8 bytes of a free block hold the offset of the next one, they may be read after another process has
+    // already popped (and overwritten) the block, in which case the tag makes the CAS fail
+    allocation_result shared_memory_allocator::allocate(size_t size) noexcept
+    {
+        if(!_writable || size > offset_mask)
+            return no_allocation;
+        auto & h    = get(_data);
+        auto index  = size_class(size);
+        auto block  = size_t{1} << (index + min_block_bits);
+        auto & free = h.free[index];
+        for(auto head = free.load(std::memory_order_acquire); head & offset_mask;) {
+            auto * ptr = _data + (head & offset_mask);
+            auto next  = std::atomic_ref{*reinterpret_cast<std::uint64_t *>(ptr)}.load(std::memory_order_relaxed);
+            if(free.compare_exchange_weak(head, retag(head, next), std::memory_order_acquire))
+                return {ptr, block};
+        }
+        // big blocks may waste up to 48 bytes for the alignment
+        auto alignment = std::min(block, size_t{64});
+        for(auto top = h.top.load(std::memory_order_relaxed);;) {
+            auto start = (top + alignment - 1) & ~(alignment - 1);
+            if(start > _size || block > _size - start)
+                return no_allocation;
+            if(h.top.compare_exchange_weak(top, start + block, std::memory_order_relaxed))
+                return {_data + start, block};
+        }
+    }
+
+    // read-only mappings can't write the link (eg. as the primary of a `fallback_allocator`)
+    void shared_memory_allocator::deallocate(allocation_result allocation) noexcept
+    {
+        if(!_writable || !allocation)
+            return;
+        auto * ptr  = static_cast<char *>(allocation.ptr);
+        auto offset = static_cast<std::uint64_t>(ptr - _data);
+        auto & free = get(_data).free[size_class(allocation.size)];
+        auto next   = std::atomic_ref{*reinterpret_cast<std::uint64_t *>(ptr)};
+        for(auto head = free.load(std::memory_order_relaxed);;) {
+            next.store(head & offset_mask, std::memory_order_relaxed);
+            if(free.compare_exchange_weak(head, retag(head, offset), std::memory_order_release))
+                return;
+        }
+    }
+
+    void * shared_memory_allocator::root() const noexcept
+    {
+        if(!_data)
+            return nullptr;
+        auto offset = get(_data).root.load(std::memory_order_acquire);
+        return offset ? _data + offset : nullptr;
+    }
+
+    void shared_memory_allocator::set_root(void * root) noexcept
+    {
+        if(!_writable)
+            return;
+        auto offset = root ? static_cast<std::uint64_t>(static_cast<char *>(root) - _data) : 0;
+        get(_data).root.store(offset, std::memory_order_release);
+    }
+}
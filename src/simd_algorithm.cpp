@@ -0,0 +1,311 @@
+#include "ranges/algorithm.hpp"
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define GSTD_SIMD_X86 1
+#else
+#define GSTD_SIMD_X86 0
+#endif
+
+namespace gstd::ranges::_impl::simd {
+    namespace {
+        namespace scalar {
+            template<typename T>
+            size_t find(T const * data, size_t size, T value) noexcept
+            {
+                for(size_t i = 0; i < size; ++i)
+                    if(data[i] == value)
+                        return i;
+                return size;
+            }
+
+            template<typename T>
+            size_t count(T const * data, size_t size, T value) noexcept
+            {
+                size_t n = 0;
+                for(size_t i = 0; i < size; ++i)
+                    n += data[i] == value;
+                return n;
+            }
+
+            template<typename T>
+            size_t mismatch(T const * a, T const * b, size_t size) noexcept
+            {
+                for(size_t i = 0; i < size; ++i)
+                    if(!(a[i] == b[i]))
+                        return i;
+                return size;
+            }
+
+            template<bool Max, typename T>
+            T extremum(T const * data, size_t size) noexcept
+            {
+                auto result = data[0];
+                for(size_t i = 1; i < size; ++i)
+                    if(Max ? result < data[i] : data[i] < result)
+                        result = data[i];
+                return result;
+            }
+        }
+
+#if GSTD_SIMD_X86
+#ifdef __i386__
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+        namespace sse2 {
+            struct vec {
+                using reg = __m128i;
+
+                static constexpr size_t bytes      = 16;
+                static constexpr std::uint32_t all = 0xffff;
+
+                template<typename T>
+                static constexpr bool has_min_max
+                  = std::same_as<T, std::uint8_t> || std::same_as<T, std::int16_t>;
+
+                static reg load(void const * ptr) noexcept { return _mm_loadu_si128(static_cast<reg const *>(ptr)); }
+
+                template<typename T>
+                static reg splat(T value) noexcept
+                {
+                    if constexpr(std::same_as<T, float>)
+                        return _mm_castps_si128(_mm_set1_ps(value));
+                    else if constexpr(std::same_as<T, double>)
+                        return _mm_castpd_si128(_mm_set1_pd(value));
+                    else if constexpr(sizeof(T) == 1)
+                        return _mm_set1_epi8(static_cast<char>(value));
+                    else if constexpr(sizeof(T) == 2)
+                        return _mm_set1_epi16(static_cast<short>(value));
+                    else if constexpr(sizeof(T) == 4)
+                        return _mm_set1_epi32(static_cast<int>(value));
+                    else
+                        return _mm_set1_epi64x(static_cast<long long>(value));
+                }
+
+                template<typename T>
+                static std::uint32_t eq(reg a, reg b) noexcept
+                {
+                    reg mask;
+                    if constexpr(std::same_as<T, float>) {
+                        mask = _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+                    } else if constexpr(std::same_as<T, double>) {
+                        mask = _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+                    } else if constexpr(sizeof(T) == 1) {
+                        mask = _mm_cmpeq_epi8(a, b);
+                    } else if constexpr(sizeof(T) == 2) {
+                        mask = _mm_cmpeq_epi16(a, b);
+                    } else if constexpr(sizeof(T) == 4) {
+                        mask = _mm_cmpeq_epi32(a, b);
+                    } else {
+                        // no 64-bit comparison before SSE4.1: both halves have to be equal
+                        mask = _mm_cmpeq_epi32(a, b);
+                        mask = _mm_and_si128(mask, _mm_shuffle_epi32(mask, _MM_SHUFFLE(2, 3, 0, 1)));
+                    }
+                    return static_cast<std::uint32_t>(_mm_movemask_epi8(mask));
+                }
+
+                template<typename T>
+                static reg min(reg a, reg b) noexcept
+                {
+                    if constexpr(sizeof(T) == 1)
+                        return _mm_min_epu8(a, b);
+                    else
+                        return _mm_min_epi16(a, b);
+                }
+
+                template<typename T>
+                static reg max(reg a, reg b) noexcept
+                {
+                    if constexpr(sizeof(T) == 1)
+                        return _mm_max_epu8(a, b);
+                    else
+                        return _mm_max_epi16(a, b);
+                }
+            };
+
+#include "simd_kernels.hpp"
+        }
+#ifdef __i386__
+#pragma GCC pop_options
+#endif
+
+#ifdef __clang__
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#else
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+        namespace avx2 {
+            struct vec {
+                using reg = __m256i;
+
+                static constexpr size_t bytes      = 32;
+                static constexpr std::uint32_t all = 0xffff'ffff;
+
+                template<typename T>
+                static constexpr bool has_min_max = sizeof(T) <= 4;
+
+                static reg load(void const * ptr) noexcept
+                {
+                    return _mm256_loadu_si256(static_cast<reg const *>(ptr));
+                }
+
+                template<typename T>
+                static reg splat(T value) noexcept
+                {
+                    if constexpr(std::same_as<T, float>)
+                        return _mm256_castps_si256(_mm256_set1_ps(value));
+                    else if constexpr(std::same_as<T, double>)
+                        return _mm256_castpd_si256(_mm256_set1_pd(value));
+                    else if constexpr(sizeof(T) == 1)
+                        return _mm256_set1_epi8(static_cast<char>(value));
+                    else if constexpr(sizeof(T) == 2)
+                        return _mm256_set1_epi16(static_cast<short>(value));
+                    else if constexpr(sizeof(T) == 4)
+                        return _mm256_set1_epi32(static_cast<int>(value));
+                    else
+                        return _mm256_set1_epi64x(static_cast<long long>(value));
+                }
+
+                template<typename T>
+                static std::uint32_t eq(reg a, reg b) noexcept
+                {
+                    reg mask;
+                    if constexpr(std::same_as<T, float>)
+                        mask = _mm256_castps_si256(
+                          _mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ)
+                        );
+                    else if constexpr(std::same_as<T, double>)
+                        mask = _mm256_castpd_si256(
+                          _mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ)
+                        );
+                    else if constexpr(sizeof(T) == 1)
+                        mask = _mm256_cmpeq_epi8(a, b);
+                    else if constexpr(sizeof(T) == 2)
+                        mask = _mm256_cmpeq_epi16(a, b);
+                    else if constexpr(sizeof(T) == 4)
+                        mask = _mm256_cmpeq_epi32(a, b);
+                    else
+                        mask = _mm256_cmpeq_epi64(a, b);
+                    return static_cast<std::uint32_t>(_mm256_movemask_epi8(mask));
+                }
+
+                template<typename T>
+                static reg min(reg a, reg b) noexcept
+                {
+                    constexpr bool is_signed = std::is_signed_v<T>;
+                    if constexpr(sizeof(T) == 1)
+                        return is_signed ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+                    else if constexpr(sizeof(T) == 2)
+                        return is_signed ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b);
+                    else
+                        return is_signed ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+                }
+
+                template<typename T>
+                static reg max(reg a, reg b) noexcept
+                {
+                    constexpr bool is_signed = std::is_signed_v<T>;
+                    if constexpr(sizeof(T) == 1)
+                        return is_signed ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+                    else if constexpr(sizeof(T) == 2)
+                        return is_signed ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b);
+                    else
+                        return is_signed ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+                }
+            };
+
+#include "simd_kernels.hpp"
+        }
+#ifdef __clang__
+#pragma clang attribute pop
+#else
+#pragma GCC pop_options
+#endif
+
+        enum class isa { scalar, sse2, avx2 };
+
+        isa detect() noexcept
+        {
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx2"))
+                return isa::avx2;
+            if(__builtin_cpu_supports("sse2"))
+                return isa::sse2;
+            return isa::scalar;
+        }
+
+        isa active() noexcept
+        {
+            static isa const level = detect();
+            return level;
+        }
+
+#define GSTD_SIMD_DISPATCH(fn, ...)           \
+    switch(active()) {                        \
+    case isa::avx2: return avx2::fn(__VA_ARGS__); \
+    case isa::sse2: return sse2::fn(__VA_ARGS__); \
+    default: return scalar::fn(__VA_ARGS__);     \
+    }
+#else
+#define GSTD_SIMD_DISPATCH(fn, ...) return scalar::fn(__VA_ARGS__);
+#endif
+    }
+
+    template<typename T>
+    size_t find(T const * data, size_t size, T value) noexcept
+    {
+        GSTD_SIMD_DISPATCH(find, data, size, value)
+    }
+
+    template<typename T>
+    size_t count(T const * data, size_t size, T value) noexcept
+    {
+        GSTD_SIMD_DISPATCH(count, data, size, value)
+    }
+
+    template<typename T>
+    size_t mismatch(T const * a, T const * b, size_t size) noexcept
+    {
+        GSTD_SIMD_DISPATCH(mismatch, a, b, size)
+    }
+
+    template<typename T>
+    T min(T const * data, size_t size) noexcept
+    {
+        GSTD_SIMD_DISPATCH(template extremum<false>, data, size)
+    }
+
+    template<typename T>
+    T max(T const * data, size_t size) noexcept
+    {
+        GSTD_SIMD_DISPATCH(template extremum<true>, data, size)
+    }
+
+#define GSTD_RANGES_SIMD_EQUALITY(T)                                  \
+    template size_t find<T>(T const *, size_t, T) noexcept;          \
+    template size_t count<T>(T const *, size_t, T) noexcept;         \
+    template size_t mismatch<T>(T const *, T const *, size_t) noexcept;
+#define GSTD_RANGES_SIMD_ORDER(T)                         \
+    template T min<T>(T const *, size_t) noexcept;       \
+    template T max<T>(T const *, size_t) noexcept;
+    GSTD_RANGES_SIMD_EQUALITY(std::uint8_t)
+    GSTD_RANGES_SIMD_EQUALITY(std::uint16_t)
+    GSTD_RANGES_SIMD_EQUALITY(std::uint32_t)
+    GSTD_RANGES_SIMD_EQUALITY(std::uint64_t)
+    GSTD_RANGES_SIMD_EQUALITY(float)
+    GSTD_RANGES_SIMD_EQUALITY(double)
+    GSTD_RANGES_SIMD_ORDER(std::int8_t)
+    GSTD_RANGES_SIMD_ORDER(std::uint8_t)
+    GSTD_RANGES_SIMD_ORDER(std::int16_t)
+    GSTD_RANGES_SIMD_ORDER(std::uint16_t)
+    GSTD_RANGES_SIMD_ORDER(std::int32_t)
+    GSTD_RANGES_SIMD_ORDER(std::uint32_t)
+    GSTD_RANGES_SIMD_ORDER(std::int64_t)
+    GSTD_RANGES_SIMD_ORDER(std::uint64_t)
+}
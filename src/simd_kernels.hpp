@@ -0,0 +1,60 @@
+// No include guard: this file is included once per instruction set by simd_algorithm.cpp.
+// It expects a `vec` type in the enclosing namespace providing `bytes`, `all`, `load`, `splat<T>`, `eq<T>` (bitmask
+// with one bit per byte) and, if `has_min_max<T>`, `min<T>`/`max<T>`, as well as the `scalar` kernels for tails.
+
+template<typename T>
+size_t find(T const * data, size_t size, T value) noexcept
+{
+    constexpr size_t lanes = vec::bytes / sizeof(T);
+    auto needle            = vec::splat(value);
+    size_t i               = 0;
+    for(; i + lanes <= size; i += lanes)
+        if(auto mask = vec::template eq<T>(vec::load(data + i), needle))
+            return i + static_cast<size_t>(std::countr_zero(mask)) / sizeof(T);
+    return i + scalar::find(data + i, size - i, value);
+}
+
+template<typename T>
+size_t count(T const * data, size_t size, T value) noexcept
+{
+    constexpr size_t lanes = vec::bytes / sizeof(T);
+    auto needle            = vec::splat(value);
+    size_t bits            = 0;
+    size_t i               = 0;
+    for(; i + lanes <= size; i += lanes)
+        bits += static_cast<size_t>(std::popcount(vec::template eq<T>(vec::load(data + i), needle)));
+    return bits / sizeof(T) + scalar::count(data + i, size - i, value);
+}
+
+template<typename T>
+size_t mismatch(T const * a, T const * b, size_t size) noexcept
+{
+    constexpr size_t lanes = vec::bytes / sizeof(T);
+    size_t i               = 0;
+    for(; i + lanes <= size; i += lanes)
+        if(auto mask = vec::template eq<T>(vec::load(a + i), vec::load(b + i)); mask != vec::all)
+            return i + static_cast<size_t>(std::countr_one(mask)) / sizeof(T);
+    return i + scalar::mismatch(a + i, b + i, size - i);
+}
+
+template<bool Max, typename T>
+T extremum(T const * data, size_t size) noexcept
+{
+    constexpr size_t lanes = vec::bytes / sizeof(T);
+    if constexpr(vec::template has_min_max<T>) {
+        if(size >= lanes) {
+            auto op  = [](auto a, auto b) { return Max ? vec::template max<T>(a, b) : vec::template min<T>(a, b); };
+            auto acc = vec::load(data);
+            size_t i = lanes;
+            for(; i + lanes <= size; i += lanes)
+                acc = op(acc, vec::load(data + i));
+            // overlapping the last full vector is fine, min and max are idempotent
+            if(i < size)
+                acc = op(acc, vec::load(data + size - lanes));
+            T reduced[lanes];
+            std::memcpy(reduced, &acc, sizeof acc);
+            return scalar::extremum<Max>(reduced, lanes);
+        }
+    }
+    return scalar::extremum<Max>(data, size);
+}
@@ -0,0 +1,36 @@
+#include "coroutine/task.hpp"
+
+#include <new>
+#include "allocation/c_allocator.hpp"
+#include "allocation/free_list.hpp"
+#include "allocation/segregator.hpp"
+
+namespace gstd::coroutine::_impl::task {
+    namespace {
+        using allocation::c_allocator_type;
+
+        template<size_t Min, size_t Max>
+        using size_class = allocation::free_list<c_allocator_type, Min, Max, 256>;
+
+        // frames of up to 2 KiB are kept in power-of-two size classes, larger ones go straight to `std::malloc`
+        using frame_allocator = allocation::segregator<
+          256,
+          allocation::segregator<128, size_class<1, 128>, size_class<129, 256>>,
+          allocation::segregator<
+            1024,
+            allocation::segregator<512, size_class<257, 512>, size_class<513, 1024>>,
+            allocation::segregator<2048, size_class<1025, 2048>, c_allocator_type>>>;
+
+        thread_local frame_allocator frames;
+    }
+
+    void * allocate_frame(size_t size)
+    {
+        auto allocation = frames.allocate(size);
+        if(!allocation)
+            throw std::bad_alloc{};
+        return allocation.ptr;
+    }
+
+    void deallocate_frame(void * frame, size_t size) noexcept { frames.deallocate({frame, size}); }
+}
@@ -0,0 +1,203 @@
+#include "parallel/thread_pool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "work_deque.hpp"
+
+namespace gstd::parallel {
+    namespace {
+        struct worker {
+            explicit worker(void const * pool, allocation::arena_size scratch_size)
+                : pool{pool}
+                , scratch{std::piecewise_construct, std::forward_as_tuple(scratch_size), std::forward_as_tuple()}
+            {}
+
+            void const * pool;
+            _impl::work_deque<_impl::task> deque;
+            scratch_allocator scratch;
+            std::uint64_t seed;
+            std::thread thread;
+        };
+
+        // the worker the calling thread is (if any)
+        thread_local worker * current = nullptr;
+    }
+
+    struct thread_pool::state {
+        // a task and whether it was handed in from outside the pool
+        using work = std::pair<_impl::task *, bool>;
+
+        work find_work(worker & self) noexcept
+        {
+            if(auto * t = self.deque.pop())
+                return {t, false};
+            // steal from a random victim onwards
+            self.seed      = self.seed * 6364136223846793005u + 1442695040888963407u;
+            auto n         = workers.size();
+            auto first     = static_cast<size_t>(self.seed >> 33) % n;
+            for(size_t i = 0; i < n; ++i) {
+                auto & victim = *workers[(first + i) % n];
+                if(&victim != &self)
+                    if(auto * t = victim.deque.steal())
+                        return {t, false};
+            }
+            if(injected_count.load(std::memory_order_acquire)) {
+                std::lock_guard lock{mutex};
+                if(!injected.empty()) {
+                    auto * t = injected.front();
+                    injected.pop_front();
+                    injected_count.fetch_sub(1, std::memory_order_relaxed);
+                    return {t, true};
+                }
+            }
+            return {nullptr, false};
+        }
+
+        void execute(work w) noexcept
+        {
+            auto [t, external] = w;
+            t->execute(*t);
+            if(external) {
+                // the submitting thread destroys `t` as soon as it sees `done`, so it's only set under the lock
+                std::lock_guard lock{mutex};
+                t->done.store(true, std::memory_order_relaxed);
+                finished.notify_all();
+            } else {
+                t->done.store(true, std::memory_order_release);
+            }
+        }
+
+        // wakes a sleeping worker after new work has been published
+        void signal() noexcept
+        {
+            epoch.fetch_add(1, std::memory_order_seq_cst);
+            if(sleeping.load(std::memory_order_seq_cst))
+                epoch.notify_one();
+        }
+
+        void work_loop(worker & self) noexcept
+        {
+            current = &self;
+            for(;;) {
+                if(auto w = find_work(self); w.first) {
+                    execute(w);
+                    continue;
+                }
+                // spin briefly before going to sleep
+                bool found = false;
+                for(int spin = 0; spin < 64 && !found; ++spin) {
+                    std::this_thread::yield();
+                    if(auto w = find_work(self); w.first) {
+                        execute(w);
+                        found = true;
+                    }
+                }
+                if(found)
+                    continue;
+                sleeping.fetch_add(1, std::memory_order_seq_cst);
+                auto e = epoch.load(std::memory_order_seq_cst);
+                if(stop.load(std::memory_order_seq_cst)) {
+                    sleeping.fetch_sub(1, std::memory_order_relaxed);
+                    return;
+                }
+                auto w = find_work(self);
+                if(!w.first)
+                    epoch.wait(e, std::memory_order_seq_cst);
+                sleeping.fetch_sub(1, std::memory_order_relaxed);
+                if(w.first)
+                    execute(w);
+            }
+        }
+
+        std::vector<std::unique_ptr<worker>> workers;
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::deque<_impl::task *> injected;
+        std::atomic<size_t> injected_count{0};
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<size_t> sleeping{0};
+        std::atomic<bool> stop{false};
+    };
+
+    thread_pool::thread_pool(size_t threads, allocation::arena_size scratch_size) : _state{std::make_unique<state>()}
+    {
+        if(threads == 0)
+            threads = std::max(std::thread::hardware_concurrency(), 1u);
+        auto & workers = _state->workers;
+        workers.reserve(threads);
+        for(size_t i = 0; i < threads; ++i) {
+            auto & w = *workers.emplace_back(std::make_unique<worker>(_state.get(), scratch_size));
+            w.seed   = i + 1;
+        }
+        // workers only start once all deques exist
+        for(auto & w : workers)
+            w->thread = std::thread{[this, &self = *w] { _state->work_loop(self); }};
+    }
+
+    thread_pool::~thread_pool()
+    {
+        _state->stop.store(true, std::memory_order_seq_cst);
+        _state->epoch.fetch_add(1, std::memory_order_seq_cst);
+        _state->epoch.notify_all();
+        for(auto & w : _state->workers)
+            w->thread.join();
+    }
+
+    thread_pool & thread_pool::global()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    size_t thread_pool::size() const noexcept { return _state->workers.size(); }
+
+    bool thread_pool::on_worker() const noexcept { return current && current->pool == _state.get(); }
+
+    bool thread_pool::starving() const noexcept
+    {
+        return !on_worker() || current->deque.empty();
+    }
+
+    scratch_allocator & thread_pool::scratch() noexcept { return current->scratch; }
+
+    void thread_pool::push(_impl::task & t)
+    {
+        current->deque.push(&t);
+        _state->signal();
+    }
+
+    bool thread_pool::pop(_impl::task & t) noexcept
+    {
+        // forks are joined in reverse order, so `t` is on top unless it (and thus everything below) was stolen
+        return current->deque.pop() == &t;
+    }
+
+    void thread_pool::wait(_impl::task & t) noexcept
+    {
+        auto & self = *current;
+        while(!t.done.load(std::memory_order_acquire)) {
+            if(auto w = _state->find_work(self); w.first)
+                _state->execute(w);
+            else
+                std::this_thread::yield();
+        }
+    }
+
+    void thread_pool::submit(_impl::task & t)
+    {
+        {
+            std::lock_guard lock{_state->mutex};
+            _state->injected.push_back(&t);
+            _state->injected_count.fetch_add(1, std::memory_order_release);
+        }
+        _state->signal();
+        std::unique_lock lock{_state->mutex};
+        _state->finished.wait(lock, [&] { return t.done.load(std::memory_order_relaxed); });
+    }
+}
@@ -0,0 +1,63 @@
+#include "utility/thread_slots.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+#include <vector>
+
+namespace gstd::utility::_impl::thread_slots {
+    namespace {
+        std::atomic<size_t> next_id{0};
+
+        // ids of the objects still alive, so exiting threads don't release slots of destroyed ones
+        std::mutex registry_mutex;
+        std::unordered_set<size_t> live;
+
+        // trivially destructible, so it can still be read after `owner` is gone
+        thread_local constinit bool destroyed = false;
+
+        // owns `local.data`, releases the slots when the thread exits
+        struct local_slots {
+            ~local_slots()
+            {
+                local     = {nullptr, 0};
+                destroyed = true;
+                std::lock_guard lock{registry_mutex};
+                for(size_t id = 0; id < slots.size(); ++id)
+                    if(slots[id].release && live.contains(id))
+                        slots[id].release(slots[id].owner, slots[id].ptr);
+            }
+
+            std::vector<slot> slots;
+        };
+
+        thread_local local_slots owner;
+    }
+
+    size_t new_id()
+    {
+        auto id = next_id.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard lock{registry_mutex};
+        live.insert(id);
+        return id;
+    }
+
+    void retire(size_t id) noexcept
+    {
+        std::lock_guard lock{registry_mutex};
+        live.erase(id);
+    }
+
+    void reserve(size_t id)
+    {
+        if(destroyed)
+            throw std::runtime_error{"thread_slots: the calling thread's table is destroyed"};
+        auto & slots = owner.slots;
+        if(id < slots.size())
+            return;
+        slots.resize(std::max(id + 1, 2 * slots.size()));
+        local = {slots.data(), slots.size()};
+    }
+}
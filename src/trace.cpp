@@ -0,0 +1,124 @@
+#include "time/trace.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace gstd::time::trace {
+    namespace {
+        struct buffer {
+            pid_t thread;
+            std::vector<std::unique_ptr<_impl::chunk>> chunks;
+        };
+
+        struct registry {
+            // guards the list of buffers and every buffer's list of chunks
+            std::mutex mutex;
+            std::vector<std::unique_ptr<buffer>> buffers;
+            std::string exit_path;
+        };
+
+        // never destroyed, threads may still record while the process exits
+        registry & global() noexcept
+        {
+            static auto * r = new registry;
+            return *r;
+        }
+
+        thread_local buffer * local_buffer = nullptr;
+
+        void write_string(std::ostream & os, char const * s)
+        {
+            os << '"';
+            for(; *s; ++s) {
+                auto c = static_cast<unsigned char>(*s);
+                if(c == '"' || c == '\\') {
+                    os << '\\' << *s;
+                } else if(c < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    os << escaped;
+                } else {
+                    os << *s;
+                }
+            }
+            os << '"';
+        }
+
+        // microseconds with nanosecond precision
+        void write_microseconds(std::ostream & os, std::int64_t nanoseconds)
+        {
+            char digits[32];
+            auto sign = nanoseconds < 0 ? "-" : "";
+            auto abs  = static_cast<std::uint64_t>(nanoseconds < 0 ? -nanoseconds : nanoseconds);
+            std::snprintf(digits, sizeof(digits), "%s%llu.%03llu", sign, static_cast<unsigned long long>(abs / 1000),
+                          static_cast<unsigned long long>(abs % 1000));
+            os << digits;
+        }
+
+        void write_exit_trace() noexcept
+        {
+            try {
+                std::ofstream file{global().exit_path};
+                write(file);
+            } catch(...) {
+            }
+        }
+    }
+
+    _impl::chunk * _impl::add_chunk() noexcept
+    {
+        auto & r = global();
+        try {
+            std::lock_guard lock{r.mutex};
+            if(!local_buffer)
+                local_buffer = r.buffers.emplace_back(std::make_unique<buffer>(::gettid())).get();
+            return local = local_buffer->chunks.emplace_back(std::make_unique<chunk>()).get();
+        } catch(...) {
+            return nullptr;
+        }
+    }
+
+    void write(std::ostream & os)
+    {
+        auto & r = global();
+        auto pid = ::getpid();
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        std::lock_guard lock{r.mutex};
+        for(auto & b : r.buffers) {
+            for(auto & c : b->chunks) {
+                auto size = c->size.load(std::memory_order_acquire);
+                for(size_t i = 0; i < size; ++i) {
+                    auto & e     = c->events[i];
+                    auto begin   = tsc_clock::from_ticks(e.begin).time_since_epoch().count();
+                    auto elapsed = tsc_clock::to_duration(static_cast<std::int64_t>(e.end - e.begin)).count();
+                    os << (first ? "\n" : ",\n") << "{\"name\":";
+                    write_string(os, e.name);
+                    os << ",\"ph\":\"X\",\"ts\":";
+                    write_microseconds(os, begin);
+                    os << ",\"dur\":";
+                    write_microseconds(os, elapsed);
+                    os << ",\"pid\":" << pid << ",\"tid\":" << b->thread << '}';
+                    first = false;
+                }
+            }
+        }
+        os << "\n]}\n";
+    }
+
+    void write_at_exit(char const * path)
+    {
+        auto & r = global();
+        std::lock_guard lock{r.mutex};
+        if(r.exit_path.empty())
+            std::atexit(write_exit_trace);
+        r.exit_path = path;
+    }
+}
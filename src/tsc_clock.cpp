@@ -0,0 +1,58 @@
+#include "time/tsc_clock.hpp"
+
+#include <thread>
+#include <utility>
+#if GSTD_TIME_TSC
+#include <cpuid.h>
+#endif
+
+namespace gstd::time::_impl::tsc {
+    namespace {
+        // fractional bits of the nanoseconds per tick
+        constexpr unsigned shift = 32;
+
+        // a counter read paired with `steady_clock`, the tightest bracket of a few attempts
+        std::pair<std::uint64_t, std::uint64_t> sample() noexcept
+        {
+            std::uint64_t ticks = 0, nanoseconds = 0, best = ~std::uint64_t{0};
+            for(int i = 0; i < 8; ++i) {
+                auto before = read<fence::start>();
+                auto now    = steady();
+                auto after  = read<fence::stop>();
+                if(after - before < best) {
+                    best        = after - before;
+                    ticks       = before + best / 2;
+                    nanoseconds = now;
+                }
+            }
+            return {ticks, nanoseconds};
+        }
+    }
+
+    bool usable() noexcept
+    {
+#if GSTD_TIME_TSC
+        unsigned eax, ebx, ecx, edx;
+        if(!__get_cpuid(0x8000'0000, &eax, &ebx, &ecx, &edx) || eax < 0x8000'0007)
+            return false;
+        __get_cpuid(0x8000'0001, &eax, &ebx, &ecx, &edx);
+        if(!(edx & (1u << 27)))
+            return false;
+        __get_cpuid(0x8000'0007, &eax, &ebx, &ecx, &edx);
+        return edx & (1u << 8);
+#else
+        return false;
+#endif
+    }
+
+    calibration calibrate() noexcept
+    {
+        if(!invariant())
+            return {0, 0, 1, 0};
+        auto [ticks0, nanoseconds0] = sample();
+        std::this_thread::sleep_for(std::chrono::milliseconds{20});
+        auto [ticks1, nanoseconds1] = sample();
+        auto multiplier             = ((nanoseconds1 - nanoseconds0) << shift) / (ticks1 - ticks0);
+        return {ticks1, static_cast<std::int64_t>(nanoseconds1), multiplier, shift};
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef GSTD_WORK_DEQUE_HPP
+#define GSTD_WORK_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace gstd::parallel::_impl {
+    // Chase-Lev work-stealing deque, memory orderings as in Lê, Pop, Cohen & Zappa Nardelli,
+    // "Correct and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013)
+    // holds `T *`s, the owner pushes and pops at the bottom, thieves steal from the top
+    template<typename T>
+    class work_deque {
+        struct ring {
+            explicit ring(std::int64_t capacity)
+                : mask{capacity - 1}, slots{new std::atomic<T *>[static_cast<std::size_t>(capacity)]}
+            {}
+
+            [[nodiscard]] T * get(std::int64_t i) const noexcept
+            {
+                return slots[static_cast<std::size_t>(i & mask)].load(std::memory_order_relaxed);
+            }
+
+            void put(std::int64_t i, T * t) noexcept
+            {
+                slots[static_cast<std::size_t>(i & mask)].store(t, std::memory_order_relaxed);
+            }
+
+            std::int64_t mask;
+            std::unique_ptr<std::atomic<T *>[]> slots;
+        };
+      public:
+        work_deque() : _ring{_rings.emplace_back(std::make_unique<ring>(256)).get()} {}
+
+        void push(T * t)
+        {
+            auto b    = _bottom.load(std::memory_order_relaxed);
+            auto top  = _top.load(std::memory_order_acquire);
+            auto * r  = _ring.load(std::memory_order_relaxed);
+            if(b - top > r->mask)
+                r = grow(r, top, b);
+            r->put(b, t);
+            // a release store rather than the paper's release fence, which thread sanitizer doesn't understand
+            _bottom.store(b + 1, std::memory_order_release);
+        }
+
+        [[nodiscard]] T * pop() noexcept
+        {
+            auto b   = _bottom.load(std::memory_order_relaxed) - 1;
+            auto * r = _ring.load(std::memory_order_relaxed);
+            _bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto top = _top.load(std::memory_order_relaxed);
+            if(top > b) {
+                _bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            auto * t = r->get(b);
+            if(top == b) {
+                // last element, race against thieves
+                if(!_top.compare_exchange_strong(
+                     top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed
+                   ))
+                    t = nullptr;
+                _bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return t;
+        }
+
+        [[nodiscard]] T * steal() noexcept
+        {
+            auto top = _top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto b = _bottom.load(std::memory_order_acquire);
+            if(top >= b)
+                return nullptr;
+            auto * t = _ring.load(std::memory_order_acquire)->get(top);
+            if(!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return nullptr;
+            return t;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+        }
+      private:
+        // thieves may still read the old ring, so it's only freed with the deque
+        ring * grow(ring * old, std::int64_t top, std::int64_t bottom)
+        {
+            auto * r = _rings.emplace_back(std::make_unique<ring>(2 * (old->mask + 1))).get();
+            for(auto i = top; i < bottom; ++i)
+                r->put(i, old->get(i));
+            _ring.store(r, std::memory_order_release);
+            return r;
+        }
+
+        alignas(64) std::atomic<std::int64_t> _top{0};
+        alignas(64) std::atomic<std::int64_t> _bottom{0};
+        std::vector<std::unique_ptr<ring>> _rings;
+        std::atomic<ring *> _ring;
+    };
+}
+
+#endif
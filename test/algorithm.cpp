@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <allocation.hpp>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <list>
+#include <random>
+#include <ranges.hpp>
+#include <vector>
+
+using namespace gstd;
+
+template<typename T>
+static void test_type(std::mt19937_64 & rng)
+{
+    std::uniform_int_distribution<int> values{0, 9};
+    for(std::size_t size : {0, 1, 7, 15, 16, 17, 31, 32, 33, 64, 100, 1000}) {
+        std::vector<T> v(size);
+        for(auto & x : v)
+            x = static_cast<T>(values(rng));
+        for(int needle = 0; needle < 10; ++needle) {
+            auto value = static_cast<T>(needle);
+            assert(ranges::find(v, value) == std::find(v.begin(), v.end(), value));
+            assert(ranges::count(v, value) == static_cast<std::size_t>(std::count(v.begin(), v.end(), value)));
+        }
+        if(size) {
+            assert(ranges::min(v) == *std::min_element(v.begin(), v.end()));
+            assert(ranges::max(v) == *std::max_element(v.begin(), v.end()));
+        }
+        auto w = v;
+        assert(ranges::equal(v, w));
+        for(std::size_t i = 0; i < size; i += 5) {
+            w[i] = static_cast<T>(w[i] + 1);
+            assert(ranges::mismatch(v, w).first == v.begin() + static_cast<std::ptrdiff_t>(i));
+            assert(!ranges::equal(v, w));
+            w[i] = v[i];
+        }
+    }
+}
+
+static void test_semantics()
+{
+    std::vector<double> d{1.0, -0.0, 2.0};
+    assert(ranges::find(d, 0.0) == d.begin() + 1);       // +0.0 == -0.0
+    std::vector<float> nan{1.f, std::numeric_limits<float>::quiet_NaN()};
+    assert(!ranges::equal(nan, nan));                     // NaN != NaN
+    std::vector<std::int8_t> bytes{-1, 2, -3};
+    assert(ranges::min(bytes) == -3 && ranges::max(bytes) == 2);
+    assert(ranges::find(bytes, 255) == bytes.end());     // not representable as `std::int8_t`
+    assert(ranges::find(bytes, -1LL) == bytes.begin());
+    std::list<int> list{3, 1, 2};                         // scalar fallback
+    assert(*ranges::find(list, 1) == 1 && ranges::count(list, 2) == 1 && ranges::max(list) == 3);
+}
+
+template<typename T>
+static void test_radix_sort(std::mt19937_64 & rng)
+{
+    for(std::size_t size : {0, 1, 2, 63, 64, 1000, 100'000}) {
+        std::vector<T> v(size);
+        for(auto & x : v) {
+            if constexpr(std::is_floating_point_v<T>)
+                x = static_cast<T>(std::uniform_real_distribution<double>{-1e6, 1e6}(rng));
+            else
+                x = static_cast<T>(rng());
+        }
+        auto sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        ranges::radix_sort(v);
+        assert(v == sorted);
+    }
+}
+
+// projections are called on `const` elements
+static_assert(std::invocable<decltype(ranges::radix_sort) const &, std::vector<int> &, int (*)(int const &)>);
+static_assert(!std::invocable<decltype(ranges::radix_sort) const &, std::vector<int> &, int (*)(int &)>);
+
+static void test_radix_sort_semantics()
+{
+    std::vector<double> d{2.0, -0.0, -1.5, 0.0, -std::numeric_limits<double>::infinity(), 1e-300, -1e-300};
+    ranges::radix_sort(d);
+    assert(std::is_sorted(d.begin(), d.end()) && std::signbit(d[3]) && !std::signbit(d[4])); // -0.0 before +0.0
+
+    // stable by projected key, scratch space from an arena
+    struct record {
+        std::int32_t key;
+        std::uint32_t order;
+    };
+    std::vector<record> records(5000);
+    std::mt19937_64 rng{1};
+    for(std::uint32_t i = 0; i < records.size(); ++i)
+        records[i] = {static_cast<std::int32_t>(rng() % 100) - 50, i};
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{1 << 17}};
+    ranges::radix_sort(records, arena, &record::key);
+    assert(std::is_sorted(records.begin(), records.end(), [](auto & a, auto & b) {
+        return a.key < b.key || (a.key == b.key && a.order < b.order);
+    }));
+    // the histograms and the buffer were given back
+    assert(arena.allocate(1 << 17));
+
+    // keys that only differ in their low byte need a single pass
+    std::vector<std::uint64_t> narrow{0x1234'0000'0000'0003, 0x1234'0000'0000'0001, 0x1234'0000'0000'0002};
+    ranges::radix_sort(narrow, [](std::uint64_t x) { return x; });
+    assert((narrow == std::vector<std::uint64_t>{0x1234'0000'0000'0001, 0x1234'0000'0000'0002, 0x1234'0000'0000'0003}));
+}
+
+int main()
+{
+    std::mt19937_64 rng{42};
+    test_type<char>(rng);
+    test_type<std::int8_t>(rng);
+    test_type<std::uint8_t>(rng);
+    test_type<std::int16_t>(rng);
+    test_type<std::uint16_t>(rng);
+    test_type<std::int32_t>(rng);
+    test_type<std::uint32_t>(rng);
+    test_type<std::int64_t>(rng);
+    test_type<std::uint64_t>(rng);
+    test_type<float>(rng);
+    test_type<double>(rng);
+    test_semantics();
+    test_radix_sort<std::uint8_t>(rng);
+    test_radix_sort<std::int16_t>(rng);
+    test_radix_sort<std::int32_t>(rng);
+    test_radix_sort<std::uint64_t>(rng);
+    test_radix_sort<std::int64_t>(rng);
+    test_radix_sort<float>(rng);
+    test_radix_sort<double>(rng);
+    test_radix_sort_semantics();
+}
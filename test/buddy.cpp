@@ -0,0 +1,134 @@
+#include <algorithm>
+#include <allocation.hpp>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace gstd;
+
+using buddy = allocation::buddy_allocator<allocation::c_allocator_type, 4096>;
+
+static_assert(allocation::ownership_aware_allocator<buddy>);
+
+static void test_basics()
+{
+    buddy alloc{allocation::arena_size{16 * 4096}};
+    assert(alloc.available() == 16 * 4096);
+    auto a = alloc.allocate(1);
+    assert(a && a.size == 4096 && alloc.owns(a));
+    assert(reinterpret_cast<std::uintptr_t>(a.ptr) % 4096 == 0);
+    // the lowest free block is taken, blocks are aligned to their size
+    auto b = alloc.allocate(3 * 4096);
+    assert(b.size == 4 * 4096 && static_cast<char *>(b.ptr) - static_cast<char *>(a.ptr) == 4 * 4096);
+    auto c = alloc.allocate(4096);
+    assert(static_cast<char *>(c.ptr) - static_cast<char *>(a.ptr) == 4096);
+    auto e = alloc.allocate(8 * 4096);
+    assert(!alloc.allocate(16 * 4096) && e.size == 8 * 4096);
+    assert(alloc.available() == 2 * 4096 && !alloc.allocate(4 * 4096));
+    // freeing merges buddies back into the whole region
+    auto d = alloc.allocate(2 * 4096);
+    assert(d && alloc.available() == 0 && !alloc.allocate(1));
+    for(auto allocation : {c, a, e, d, b})
+        alloc.deallocate(allocation);
+    assert(alloc.available() == 16 * 4096 && alloc.allocate(16 * 4096));
+
+    // 7 pages are a block of 4, one of 2 and one of 1
+    buddy odd{allocation::arena_size{7 * 4096 + 100}};
+    assert(odd.available() == 7 * 4096 && !odd.allocate(5 * 4096));
+    auto four = odd.allocate(4 * 4096), two = odd.allocate(2 * 4096), one = odd.allocate(1);
+    assert(four && two && one && !odd.allocate(1));
+    odd.deallocate(two);
+    odd.deallocate(one);
+    assert(!odd.allocate(3 * 4096) && odd.allocate(2 * 4096));
+
+    buddy moved_from{allocation::arena_size{4096}};
+    buddy moved_to{std::move(moved_from)};
+    assert(!moved_from.allocate(1) && moved_to.allocate(1));
+    buddy empty{allocation::arena_size{100}};
+    assert(!empty.allocate(1) && !empty.owns(a));
+}
+
+// random blocks never overlap, and everything merges again in the end
+static void test_random()
+{
+    constexpr size_t pages = 1000;
+    buddy alloc{allocation::arena_size{pages * 4096}};
+    std::mt19937_64 rng{42};
+    std::vector<allocation::allocation_result> live;
+    // the largest block starts the region
+    auto largest  = alloc.allocate(512 * 4096);
+    auto * region = static_cast<char *>(largest.ptr);
+    alloc.deallocate(largest);
+    for(int i = 0; i < 20'000; ++i) {
+        if(rng() % 2 && !live.empty()) {
+            auto j = rng() % live.size();
+            alloc.deallocate(live[j]);
+            live[j] = live.back();
+            live.pop_back();
+        } else if(auto a = alloc.allocate(static_cast<size_t>(rng() % (16 * 4096)) + 1)) {
+            assert(alloc.owns(a));
+            live.push_back(a);
+        }
+        if(i % 1000 == 0) {
+            std::vector<bool> used(pages);
+            for(auto a : live) {
+                auto first = static_cast<size_t>(static_cast<char *>(a.ptr) - region) / 4096;
+                for(auto page = first; page < first + a.size / 4096; ++page) {
+                    assert(!used[page]);
+                    used[page] = true;
+                }
+            }
+            auto count = static_cast<size_t>(std::count(used.begin(), used.end(), true));
+            assert(count * 4096 + alloc.available() == pages * 4096);
+        }
+    }
+    for(auto a : live)
+        alloc.deallocate(a);
+    assert(alloc.available() == pages * 4096 && alloc.allocate(512 * 4096));
+}
+
+// more blocks than one summary word covers, the lowest free one is always taken
+static void test_summaries()
+{
+    constexpr size_t blocks = 4 * 4096;
+    allocation::buddy_allocator<allocation::c_allocator_type, 16> alloc{allocation::arena_size{blocks * 16}};
+    std::vector<allocation::allocation_result> all;
+    for(size_t i = 0; i < blocks; ++i)
+        all.push_back(alloc.allocate(16));
+    assert(!alloc.allocate(16) && alloc.available() == 0);
+    for(size_t i = 1; i < blocks; ++i)
+        assert(static_cast<char *>(all[i].ptr) == static_cast<char *>(all[0].ptr) + i * 16);
+    // odd blocks don't merge with their (allocated) buddies, freed from the highest one
+    for(size_t i = blocks - 1; i > 4096; i -= 2)
+        alloc.deallocate(all[i]);
+    for(size_t i = 4097; i < blocks; i += 2)
+        assert(alloc.allocate(16).ptr == all[i].ptr);
+    assert(!alloc.allocate(16));
+    for(auto a : all)
+        alloc.deallocate(a);
+    assert(alloc.available() == blocks * 16);
+}
+
+// as the primary of a `fallback_allocator`, anything too large goes to the fallback
+static void test_fallback()
+{
+    allocation::fallback_allocator<buddy, allocation::c_allocator_type> alloc{
+      buddy{allocation::arena_size{4 * 4096}},
+      allocation::c_allocator};
+    auto small = alloc.allocate(4096);
+    auto large = alloc.allocate(64 * 4096);
+    assert(small && large);
+    std::memset(large.ptr, 0, large.size);
+    alloc.deallocate(large);
+    alloc.deallocate(small);
+}
+
+int main()
+{
+    test_basics();
+    test_random();
+    test_summaries();
+    test_fallback();
+}
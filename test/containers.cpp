@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <allocation.hpp>
+#include <cassert>
+#include <containers.hpp>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace gstd;
+
+static_assert(ranges::forward_range<containers::flat_set<int>>);
+static_assert(ranges::forward_range<containers::flat_map<int, std::string> const>);
+
+static void test_set(std::mt19937_64 & rng)
+{
+    for(std::size_t size : {0, 1, 2, 3, 7, 8, 9, 100, 1000, 4097}) {
+        std::vector<std::uint32_t> input(size);
+        for(auto & x : input)
+            x = static_cast<std::uint32_t>(rng() % (2 * size + 1)) * 2; // even, with duplicates
+        containers::flat_set<std::uint32_t> set{input};
+        std::set<std::uint32_t> expected(input.begin(), input.end());
+        assert(set.size() == expected.size());
+        assert(std::equal(set.begin(), set.end(), expected.begin(), expected.end()));
+        for(std::uint32_t x = 0; x <= 4 * size + 4; ++x) {
+            auto it = set.lower_bound(x);
+            auto e  = expected.lower_bound(x);
+            assert(e == expected.end() ? it == set.end() : *it == *e);
+            assert(set.contains(x) == expected.contains(x));
+        }
+    }
+}
+
+static void test_map()
+{
+    // the first of equal keys wins
+    std::vector<std::pair<std::string, int>> input{{"b", 2}, {"a", 1}, {"c", 3}, {"b", 20}};
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{1 << 12}};
+    containers::flat_map<std::string, int, std::ranges::less, decltype(arena)> map{input, arena};
+    assert(map.size() == 3 && map.at("b") == 2 && map.find(std::string{"d"}) == map.end());
+    map.at("a") = 10; // values are mutable
+    std::vector<std::pair<std::string, int>> contents;
+    for(auto [key, value] : map)
+        contents.emplace_back(key, value);
+    assert((contents == std::vector<std::pair<std::string, int>>{{"a", 10}, {"b", 2}, {"c", 3}}));
+    try {
+        (void) map.at("d");
+        assert(false);
+    } catch(std::out_of_range const &) {}
+
+    // from another map, reversed order
+    std::map<int, int> source{{1, 1}, {2, 4}, {3, 9}};
+    containers::flat_map<int, int, std::ranges::greater> squares{source};
+    assert((*squares.begin()).first == 3 && squares.at(2) == 4);
+    auto moved = std::move(squares);
+    assert(moved.size() == 3 && squares.empty() && squares.begin() == squares.end());
+
+    // stateless allocators can be passed as constants
+    containers::flat_map<int, int> copied{source, allocation::c_allocator};
+    containers::flat_set<int> keys{std::vector{3, 1, 2}, allocation::c_allocator, std::ranges::less{}};
+    assert(copied.at(3) == 9 && keys.size() == 3 && *keys.begin() == 1);
+}
+
+int main()
+{
+    std::mt19937_64 rng{42};
+    test_set(rng);
+    test_map();
+}
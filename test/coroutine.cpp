@@ -0,0 +1,238 @@
+#include <allocation.hpp>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <coroutine.hpp>
+#include <ranges.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include "counting_allocator.hpp"
+
+using namespace gstd;
+using coroutine::elements_of;
+using coroutine::generator;
+using coroutine::scheduler;
+using coroutine::task;
+using namespace std::chrono_literals;
+
+static_assert(ranges::input_range<generator<int>>);
+static_assert(!ranges::forward_range<generator<int>>);
+
+static generator<int> iota(int first, int last)
+{
+    for(; first != last; ++first)
+        co_yield first;
+}
+
+struct tree {
+    int value;
+    std::vector<tree> children;
+};
+
+// pre-order, nesting depth equals the tree's
+static generator<int> visit(tree const & node)
+{
+    co_yield node.value;
+    for(auto & child : node.children)
+        co_yield elements_of(visit(child));
+}
+
+template<typename Alloc>
+static generator<std::string> words(std::allocator_arg_t, Alloc &, std::vector<std::string> const & from)
+{
+    co_yield "first";
+    co_yield elements_of(from);
+    std::string last = "last";
+    co_yield std::move(last);
+}
+
+static generator<int> throwing(int after)
+{
+    co_yield elements_of(iota(0, after));
+    throw std::runtime_error{"done"};
+}
+
+static generator<int> nested_throwing()
+{
+    co_yield elements_of(throwing(2));
+}
+
+struct counter {
+    generator<int> count(std::allocator_arg_t, counting_allocator &) const
+    {
+        for(int i = 0; i != limit; ++i)
+            co_yield i;
+    }
+
+    int limit;
+};
+
+static task<long> fib(scheduler & sched, int n)
+{
+    // moves onto the worker's deque, where idle workers may steal it
+    co_await sched.schedule();
+    if(n < 2)
+        co_return n;
+    auto [a, b] = co_await coroutine::when_all(fib(sched, n - 1), fib(sched, n - 2));
+    co_return a + b;
+}
+
+static task<int> square(scheduler & sched, int i)
+{
+    co_await sched.schedule();
+    if(i < 0)
+        throw std::invalid_argument{"negative"};
+    co_return i * i;
+}
+
+static task<std::vector<int>> squares(scheduler & sched, std::vector<int> values)
+{
+    std::vector<task<int>> tasks;
+    for(int i : values)
+        tasks.push_back(square(sched, i));
+    co_return co_await coroutine::when_all(std::move(tasks));
+}
+
+static task<void> record_after(scheduler & sched, std::chrono::milliseconds delay, std::vector<int> & order, int id)
+{
+    co_await sched.sleep_for(delay);
+    order.push_back(id);
+}
+
+static task<std::string> read_pipe(scheduler & sched, int fd)
+{
+    co_await sched.readable(fd);
+    char buffer[16];
+    auto n = ::read(fd, buffer, sizeof(buffer));
+    co_return std::string(buffer, static_cast<size_t>(n));
+}
+
+static task<void> write_pipe(scheduler & sched, int fd)
+{
+    co_await sched.sleep_for(5ms);
+    co_await sched.writable(fd);
+    [[maybe_unused]] auto n = ::write(fd, "ping", 4);
+}
+
+static task<void> increment(scheduler & sched, std::atomic<int> & counter)
+{
+    co_await sched.schedule();
+    counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+static task<void> wait_for(scheduler & sched, std::atomic<int> & counter, int value)
+{
+    while(counter.load(std::memory_order_relaxed) != value)
+        co_await sched.sleep_for(1ms);
+}
+
+static void test_scheduler()
+{
+    scheduler sched{4};
+    assert(sched.size() == 4);
+    assert(sched.block_on(fib(sched, 20)) == 6765);
+    assert((sched.block_on(squares(sched, {1, 2, 3})) == std::vector{1, 4, 9}));
+    try {
+        (void) sched.block_on(squares(sched, {1, -2, 3}));
+        assert(false);
+    } catch(std::invalid_argument const &) {}
+
+    // timers fire in deadline order, whatever order they were started in
+    std::vector<int> order;
+    auto timers = [](scheduler & s, std::vector<int> & o) -> task<void> {
+        co_await coroutine::when_all(
+          record_after(s, 30ms, o, 3), record_after(s, 10ms, o, 1), record_after(s, 20ms, o, 2)
+        );
+    };
+    auto start = std::chrono::steady_clock::now();
+    sched.block_on(timers(sched, order));
+    assert(std::chrono::steady_clock::now() - start >= 30ms);
+    assert((order == std::vector{1, 2, 3}));
+
+    int fds[2];
+    assert(::pipe(fds) == 0);
+    auto [message, _] = sched.block_on(coroutine::when_all(read_pipe(sched, fds[0]), write_pipe(sched, fds[1])));
+    assert(message == "ping");
+    ::close(fds[0]);
+    ::close(fds[1]);
+
+    std::atomic<int> counter{0};
+    for(int i = 0; i < 1000; ++i)
+        sched.spawn(increment(sched, counter));
+    sched.block_on(wait_for(sched, counter, 1000));
+}
+
+int main()
+{
+    std::vector<int> v;
+    for(int i : iota(0, 5))
+        v.push_back(i);
+    assert((v == std::vector{0, 1, 2, 3, 4}));
+    assert(ranges::to<std::vector>(iota(3, 6) | ranges::views::transform([](int i) { return i * i; }))
+           == (std::vector{9, 16, 25}));
+
+    tree t{0, {{1, {{2, {}}, {3, {{4, {}}}}}}, {5, {}}}};
+    assert((ranges::to<std::vector>(visit(t)) == std::vector{0, 1, 2, 3, 4, 5}));
+    // deep nesting is resumed directly at the leaf
+    tree deep{0, {}};
+    tree * leaf = &deep;
+    for(int i = 1; i != 1000; ++i)
+        leaf = &leaf->children.emplace_back(tree{i, {}});
+    int expected = 0;
+    for(int i : visit(deep))
+        assert(i == expected++);
+    assert(expected == 1000);
+
+    allocation::stack_allocator<4096, 16> stack;
+    std::vector<std::string> middle{"a", "b"};
+    {
+        auto gen = words(std::allocator_arg, stack, middle);
+        // the frame lives in the buffer
+        assert(!stack.allocate(4096));
+        assert((ranges::to<std::vector>(gen) == std::vector<std::string>{"first", "a", "b", "last"}));
+    }
+    assert(stack.allocate(4096));
+
+    counting_allocator counting;
+    {
+        counter c{3};
+        auto gen = c.count(std::allocator_arg, counting);
+        assert(counting.allocations == 1 && counting.deallocations == 0);
+        assert((ranges::to<std::vector>(gen) == std::vector{0, 1, 2}));
+    }
+    assert(counting.allocations == 1 && counting.deallocations == 1);
+    {
+        auto gen = words(std::allocator_arg, counting, middle);
+        assert((ranges::to<std::vector>(gen) == std::vector<std::string>{"first", "a", "b", "last"}));
+        // the frame wrapping `middle` came from the same allocator
+        assert(counting.allocations == 3 && counting.deallocations == 2);
+    }
+    assert(counting.live() == 0);
+
+    int seen = 0;
+    try {
+        for(int i : throwing(3))
+            assert(i == seen++);
+        assert(false);
+    } catch(std::runtime_error const &) {
+        assert(seen == 3);
+    }
+
+    seen = 0;
+    try {
+        for(int i : nested_throwing())
+            assert(i == seen++);
+        assert(false);
+    } catch(std::runtime_error const &) {
+        assert(seen == 2);
+    }
+
+    // abandoned part-way
+    auto gen = visit(t);
+    auto it  = gen.begin();
+    assert(*it == 0 && *++it == 1 && *++it == 2);
+
+    test_scheduler();
+}
@@ -0,0 +1,32 @@
+#ifndef GSTD_TEST_COUNTING_ALLOCATOR_HPP
+#define GSTD_TEST_COUNTING_ALLOCATOR_HPP
+
+#include <allocation.hpp>
+#include <atomic>
+#include <cstring>
+
+// counts the calls into the C allocator (from any thread) and scribbles over deallocated memory, so reading a freed
+// block is noticed
+struct counting_allocator {
+    [[nodiscard]] gstd::allocation::allocation_result allocate(gstd::allocation::size_t size) noexcept
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        return gstd::allocation::c_allocator.allocate(size);
+    }
+
+    void deallocate(gstd::allocation::allocation_result allocation) noexcept
+    {
+        deallocations.fetch_add(1, std::memory_order_relaxed);
+        if(allocation)
+            std::memset(allocation.ptr, 0, allocation.size);
+        gstd::allocation::c_allocator.deallocate(allocation);
+    }
+
+    // allocations not deallocated yet
+    [[nodiscard]] long live() const noexcept { return allocations.load() - deallocations.load(); }
+
+    std::atomic<long> allocations{0};
+    std::atomic<long> deallocations{0};
+};
+
+#endif
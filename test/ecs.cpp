@@ -0,0 +1,172 @@
+#include <cassert>
+#include <concepts>
+#include <cstdlib>
+#include <ecs.hpp>
+#include <new>
+#include <string>
+
+using namespace gstd;
+using meta::type_sequence::type_sequence;
+
+struct position {
+    float x, y;
+};
+
+struct velocity {
+    float dx, dy;
+};
+
+struct name {
+    std::string value;
+};
+
+using components = type_sequence<position, velocity, name>;
+using universe   = ecs::component_universe<components>;
+
+static_assert(std::same_as<universe::canonical<name, position, name>, type_sequence<position, name>>);
+static_assert(universe::id<velocity, position> == universe::id<position, velocity, position>);
+static_assert(universe::id<position, velocity> == 0b011);
+static_assert(universe::id<name> == 0b100);
+static_assert(universe::id<> == 0);
+
+static void test_create_and_get()
+{
+    ecs::registry<components> reg;
+    auto a = reg.create(position{1, 2}, velocity{1, 0});
+    auto b = reg.create(velocity{0, 1}, position{3, 4}); // same archetype as `a`
+    auto c = reg.create(name{"c"});
+    assert(reg.size() == 3 && reg.archetype_count() == 2);
+    assert(reg.get<position>(a)->x == 1 && reg.get<position>(b)->x == 3);
+    assert(reg.get<name>(c)->value == "c");
+    assert(!reg.get<name>(a) && !reg.has<position>(c));
+    reg.destroy(a);
+    assert(!reg.alive(a) && reg.alive(b) && reg.get<position>(b)->y == 4);
+    auto d = reg.create();
+    assert(d.index == a.index && d != a && !reg.get<position>(a));
+}
+
+static void test_each()
+{
+    ecs::registry<components> reg;
+    for(int i = 0; i < 10'000; ++i) {
+        auto e = reg.create(position{0, 0}, velocity{1, static_cast<float>(i % 2)});
+        if(i % 3 == 0)
+            reg.emplace<name>(e, std::to_string(i));
+    }
+    reg.each<position, velocity const>([](position & p, velocity const & v) {
+        p.x += v.dx;
+        p.y += v.dy;
+    });
+    float sum_x = 0, sum_y = 0;
+    reg.each<position const>([&](position const & p) {
+        sum_x += p.x;
+        sum_y += p.y;
+    });
+    assert(sum_x == 10'000 && sum_y == 5'000);
+    size_t named = 0;
+    reg.each<name, position>([&](ecs::entity e, name & n, position &) {
+        assert(reg.get<name>(e) == &n);
+        ++named;
+    });
+    assert(named == 3'334);
+}
+
+static void test_migration()
+{
+    ecs::registry<components> reg;
+    auto a = reg.create(position{1, 1});
+    auto b = reg.create(position{2, 2});
+    reg.emplace<name>(a, "a");
+    reg.emplace<velocity>(a, 5.f, 6.f);
+    assert(reg.has<position>(a) && reg.has<velocity>(a) && reg.get<name>(a)->value == "a");
+    assert(reg.get<position>(a)->x == 1 && reg.get<position>(b)->x == 2);
+    reg.remove<position>(a);
+    assert(!reg.has<position>(a) && reg.get<velocity>(a)->dy == 6 && reg.get<name>(a)->value == "a");
+    reg.emplace<name>(a, "renamed");
+    assert(reg.get<name>(a)->value == "renamed");
+    reg.remove<name>(b); // no-op
+    assert(reg.get<position>(b)->y == 2);
+}
+
+// `operator new` throws on the `fail_allocation`th call from now on (never while 0)
+static int fail_allocation = 0;
+
+void * operator new(size_t size)
+{
+    if(fail_allocation && !--fail_allocation)
+        throw std::bad_alloc{};
+    if(auto * ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+// out of line, GCC would warn about `free` on memory from `new` otherwise
+[[gnu::noinline]] void operator delete(void * ptr) noexcept { std::free(ptr); }
+
+[[gnu::noinline]] void operator delete(void * ptr, size_t) noexcept { std::free(ptr); }
+
+// fails every allocation once `budget` is used up
+struct limited_allocator {
+    [[nodiscard]] allocation::allocation_result allocate(size_t size) noexcept
+    {
+        if(!budget)
+            return allocation::no_allocation;
+        --budget;
+        return allocation::c_allocator.allocate(size);
+    }
+
+    void deallocate(allocation::allocation_result allocation) noexcept
+    {
+        allocation::c_allocator.deallocate(allocation);
+    }
+
+    size_t budget;
+};
+
+static void test_failures()
+{
+    ecs::registry<components, limited_allocator> reg{limited_allocator{1}};
+    auto a = reg.create(position{1, 2});
+    bool thrown = false;
+    try {
+        [[maybe_unused]] auto b = reg.create(name{"b"});
+    } catch(std::bad_alloc const &) {
+        thrown = true;
+    }
+    // no entity without a row is left behind
+    assert(thrown && reg.size() == 1 && reg.alive(a));
+
+    // an archetype that couldn't be registered isn't looked up later on
+    ecs::registry<components> grown;
+    auto c = grown.create(position{1, 2});
+    fail_allocation = 2;
+    thrown          = false;
+    try {
+        grown.emplace<velocity>(c, 3.f, 4.f);
+    } catch(std::bad_alloc const &) {
+        thrown = true;
+    }
+    fail_allocation = 0;
+    assert(thrown && grown.archetype_count() == 1 && !grown.has<velocity>(c));
+    grown.emplace<velocity>(c, 3.f, 4.f);
+    assert(grown.archetype_count() == 2 && grown.get<velocity>(c)->dy == 4 && grown.get<position>(c)->x == 1);
+}
+
+static void test_aliasing()
+{
+    // arguments may refer to the replaced component
+    ecs::registry<components> reg;
+    auto a = reg.create(name{"a"});
+    reg.emplace<name>(a, *reg.get<name>(a));
+    reg.emplace<name>(a, std::move(*reg.get<name>(a)));
+    assert(reg.get<name>(a)->value == "a");
+}
+
+int main()
+{
+    test_create_and_get();
+    test_each();
+    test_migration();
+    test_failures();
+    test_aliasing();
+}
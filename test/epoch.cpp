@@ -0,0 +1,88 @@
+#include <allocation.hpp>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "counting_allocator.hpp"
+
+using namespace gstd;
+
+struct value {
+    explicit value(std::uint64_t n) noexcept : check{~n}, n{n} {}
+
+    ~value() { check = 0; }
+
+    std::uint64_t check;
+    std::uint64_t n;
+};
+
+static void test_guards(counting_allocator & alloc)
+{
+    allocation::epoch_domain domain{alloc};
+    {
+        auto outer = domain.pin();
+        auto inner = domain.pin();
+    }
+    // nothing can be reclaimed while this thread is pinned
+    {
+        auto guard = domain.pin();
+        for(int i = 0; i < 1000; ++i)
+            domain.retire(allocation::create<value>(alloc, 1));
+        assert(alloc.live() == 1000);
+    }
+    // retiring advances the epoch, so blocks are freed once the thread has unpinned
+    for(int i = 0; i < 1000; ++i)
+        domain.retire(alloc.allocate(16));
+    assert(alloc.live() < 1000);
+    // a thread that has exited doesn't hold anything up, its blocks are taken over
+    std::thread{[&] {
+        auto guard = domain.pin();
+        domain.retire(allocation::create<value>(alloc, 2));
+    }}.join();
+    for(int i = 0; i < 10; ++i)
+        domain.collect();
+}
+
+// readers follow a pointer writers keep replacing
+static void test_readers(counting_allocator & alloc)
+{
+    allocation::epoch_domain domain{alloc};
+    std::atomic<value *> current{allocation::create<value>(alloc, 0).ptr};
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for(int r = 0; r < 3; ++r) {
+        threads.emplace_back([&] {
+            while(!done.load(std::memory_order_relaxed)) {
+                auto guard = domain.pin();
+                auto * v   = current.load(std::memory_order_acquire);
+                assert(v->check == ~v->n);
+            }
+        });
+    }
+    for(int w = 0; w < 2; ++w) {
+        threads.emplace_back([&] {
+            for(std::uint64_t i = 1; i <= 20'000; ++i) {
+                auto replacement = allocation::create<value>(alloc, i);
+                auto * old       = current.exchange(replacement.ptr, std::memory_order_acq_rel);
+                domain.retire(allocation::creation_result<value>{old, sizeof(value)});
+            }
+        });
+    }
+    for(size_t i = 3; i < threads.size(); ++i)
+        threads[i].join();
+    done = true;
+    for(size_t i = 0; i < 3; ++i)
+        threads[i].join();
+    allocation::destroy(alloc, allocation::creation_result<value>{current.load(), sizeof(value)});
+}
+
+int main()
+{
+    counting_allocator alloc;
+    test_guards(alloc);
+    // destroying the domain frees everything left
+    assert(alloc.live() == 0);
+    test_readers(alloc);
+    assert(alloc.live() == 0);
+}
@@ -0,0 +1,113 @@
+#include <allocation.hpp>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility/function.hpp>
+#include <vector>
+#include "counting_allocator.hpp"
+
+using namespace gstd;
+
+static int twice(int x) { return 2 * x; }
+
+static void test_function()
+{
+    utility::function<int(int)> f;
+    assert(!f && f == nullptr);
+    try {
+        f(1);
+        assert(false);
+    } catch(std::bad_function_call const &) {}
+
+    f = twice;
+    assert(f && f(21) == 42);
+    int (*null)(int) = nullptr;
+    f                = null;
+    assert(!f);
+
+    // too large to be stored inline
+    std::array<int, 64> big{};
+    big[63] = 5;
+    f       = [big](int x) { return big[63] + x; };
+    auto g  = f;
+    assert(f(1) == 6 && g(2) == 7);
+    auto h = std::move(g);
+    assert(!g && h(3) == 8);
+    swap(f, h);
+    assert(f(0) == 5);
+
+    std::string s = "abc";
+    utility::function<size_t(std::string const &) noexcept> size = [](std::string const & str) noexcept {
+        return str.size();
+    };
+    assert(size(s) == 3);
+    static_assert(noexcept(size(s)));
+    static_assert(!std::is_constructible_v<utility::function<void() noexcept>, void (*)()>);
+}
+
+static void test_move_only()
+{
+    auto p = std::make_unique<int>(7);
+    utility::move_only_function<int()> f{[p = std::move(p)] { return *p; }};
+    static_assert(!std::is_copy_constructible_v<decltype(f)>);
+    static_assert(!std::is_constructible_v<utility::function<int()>, decltype([p = std::unique_ptr<int>{}] {
+                                               return 0;
+                                           })>);
+    auto g = std::move(f);
+    assert(!f && g() == 7);
+
+    std::vector<utility::move_only_function<void(std::vector<int> &)>> queue;
+    for(int i = 0; i < 100; ++i)
+        queue.emplace_back([i](std::vector<int> & out) { out.push_back(i); });
+    std::vector<int> out;
+    for(auto & callback : queue)
+        callback(out);
+    assert(out.size() == 100 && out[99] == 99);
+}
+
+static void test_allocator()
+{
+    counting_allocator alloc;
+    {
+        using fn = utility::function<int(), 16, counting_allocator>;
+        fn small{[] { return 1; }, alloc};
+        assert(alloc.live() == 0);
+        std::array<char, 100> big{};
+        big[99] = 2;
+        fn large{[big] { return int{big[99]}; }, alloc};
+        assert(alloc.live() == 1);
+        auto copy = large;
+        assert(alloc.live() == 2 && copy() == 2);
+        auto moved = std::move(copy);
+        assert(alloc.live() == 2 && moved() == 2);
+        small = [big] { return int{big[99]} + 1; };
+        assert(alloc.live() == 3 && small() == 3);
+        // without an allocator only inline targets can be stored
+        fn none;
+        try {
+            none = [big] { return int{big[0]}; };
+            assert(false);
+        } catch(std::bad_alloc const &) {}
+        none = [] { return 4; };
+        assert(none() == 4);
+        // over-aligned targets are allocated with their alignment
+        struct alignas(64) aligned {
+            int operator()() const noexcept { return reinterpret_cast<std::uintptr_t>(this) % 64 == 0 ? 5 : 0; }
+        };
+        fn over{aligned{}, alloc};
+        assert(alloc.live() == 4 && over() == 5);
+        auto over_copy = over;
+        assert(over_copy() == 5);
+    }
+    assert(alloc.live() == 0);
+}
+
+int main()
+{
+    test_function();
+    test_move_only();
+    test_allocator();
+}
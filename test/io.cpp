@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cstring>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <io.hpp>
+#include <random>
+#include <ranges.hpp>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using namespace gstd;
+
+static std::string temporary(std::string const & contents)
+{
+    std::string path = "/tmp/gstd_test_io";
+    std::ofstream{path, std::ios::binary} << contents;
+    return path;
+}
+
+static void test_lines(std::string const & contents)
+{
+    auto path = temporary(contents);
+    io::mapped_file file{path.c_str(), io::advice::sequential};
+    assert(ranges::size(file) == contents.size() && std::string(file.begin(), file.end()) == contents);
+    file.advise(io::advice::will_need, 1, 100);
+    std::istringstream stream{contents};
+    std::string line;
+    auto lines = file | ranges::views::lines;
+    auto it    = lines.begin();
+    for(; std::getline(stream, line); ++it)
+        assert(it != lines.end() && *it == line);
+    assert(it == lines.end());
+    // fields point into the mapping
+    size_t fields = 0;
+    for(auto field : file | ranges::views::split(',')) {
+        assert(file.begin() <= field.data() && field.data() + field.size() <= file.end());
+        ++fields;
+    }
+    auto commas = static_cast<size_t>(std::count(contents.begin(), contents.end(), ','));
+    assert(fields == (contents.empty() ? 0 : commas + 1));
+    std::remove(path.c_str());
+}
+
+static void test_byte_ring()
+{
+    io::byte_ring ring{100};
+    auto capacity = ring.capacity();
+    assert(capacity >= 100 && ring.empty() && ring.writable().size() == capacity);
+    // wraps around the end
+    std::string filler(capacity - 3, 'x');
+    assert(ring.write(filler.data(), filler.size()) == filler.size());
+    ring.consume(filler.size());
+    char const message[] = "key=value,wrapped=yes";
+    assert(ring.write(message, sizeof(message) - 1) == sizeof(message) - 1);
+    assert(ranges::size(ring) == sizeof(message) - 1 && ranges::data(ring) == ring.data());
+    assert(std::string(ranges::begin(ring), ranges::end(ring)) == message);
+    size_t fields = 0;
+    for(auto field : ring | ranges::views::split(','))
+        fields += field.size() > 0;
+    assert(fields == 2);
+    // both mappings are the same memory
+    ring.data()[4] = 'V';
+    assert(ring.data()[4 - static_cast<std::ptrdiff_t>(capacity)] == 'V');
+    ring.consume(4);
+    assert(std::string(ring.begin(), ring.end()) == "Value,wrapped=yes");
+
+    // writable space is contiguous too, and bounded by the capacity
+    auto free = ring.writable();
+    assert(free.data() == ring.end() && free.size() == capacity - ring.size());
+    std::memset(free.data(), '#', free.size());
+    ring.commit(free.size());
+    assert(ring.full() && ring.write("z", 1) == 0);
+    assert(std::count(ring.begin(), ring.end(), '#') == static_cast<std::ptrdiff_t>(free.size()));
+    ring.consume(ring.size());
+    assert(ring.empty());
+
+    io::byte_ring moved{std::move(ring)};
+    assert(moved.capacity() == capacity && ring.capacity() == 0);
+}
+
+int main()
+{
+    test_byte_ring();
+    test_lines("");
+    test_lines("\n");
+    test_lines("single line without newline");
+    test_lines("a,b\nc,d\n\n,\n");
+    std::mt19937_64 rng{42};
+    std::string contents;
+    for(int i = 0; i < 10'000; ++i)
+        contents += rng() % 8 ? static_cast<char>('a' + rng() % 26) : rng() % 2 ? '\n' : ',';
+    test_lines(contents);
+
+    io::mapped_file moved{std::move(io::mapped_file{})};
+    assert(moved.empty() && moved.data() == nullptr);
+    bool thrown = false;
+    try {
+        io::mapped_file missing{"/nonexistent/gstd"};
+    } catch(std::system_error const &) {
+        thrown = true;
+    }
+    assert(thrown);
+}
@@ -0,0 +1,208 @@
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <parallel.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace gstd;
+
+static void test_join(parallel::thread_pool & pool)
+{
+    // naive fibonacci forks a lot of tiny tasks
+    auto fib = [&](auto & self, int n) -> std::uint64_t {
+        if(n < 2)
+            return static_cast<std::uint64_t>(n);
+        std::uint64_t a, b;
+        pool.join([&] { a = self(self, n - 1); }, [&] { b = self(self, n - 2); });
+        return a + b;
+    };
+    assert(fib(fib, 25) == 75025);
+    bool thrown = false;
+    try {
+        pool.join([] {}, [] { throw std::runtime_error{"right"}; });
+    } catch(std::runtime_error const & e) {
+        thrown = std::string{e.what()} == "right";
+    }
+    assert(thrown);
+}
+
+static void test_algorithms(parallel::thread_pool & pool, std::mt19937_64 & rng)
+{
+    for(std::size_t size : {0, 1, 2, 100, 5000, 100'000, 1'000'000}) {
+        std::vector<std::int64_t> v(size);
+        for(auto & x : v)
+            x = static_cast<std::int64_t>(rng() % 1000);
+
+        std::vector<std::atomic<int>> visits(size);
+        parallel::for_each(pool, visits, [](std::atomic<int> & x) { ++x; });
+        assert(std::all_of(visits.begin(), visits.end(), [](auto & x) { return x == 1; }));
+
+        auto square = [](std::int64_t x) { return x * x; };
+        auto sum    = parallel::transform_reduce(pool, v, std::int64_t{7}, std::plus<>{}, square);
+        assert(sum == std::transform_reduce(v.begin(), v.end(), std::int64_t{7}, std::plus<>{}, square));
+
+        std::vector<std::int64_t> scanned(size), expected(size);
+        std::inclusive_scan(v.begin(), v.end(), expected.begin());
+        assert(parallel::inclusive_scan(pool, v, scanned.begin()) == scanned.end() && scanned == expected);
+        parallel::inclusive_scan(pool, scanned, scanned.begin(), [](auto a, auto b) { return std::max(a, b); });
+        assert(scanned == expected); // in-place, idempotent on sorted input
+
+        auto w    = v;
+        auto odd  = [](std::int64_t x) { return x % 2 != 0; };
+        auto last = parallel::partition(pool, w, odd);
+        assert(std::all_of(w.begin(), last, odd) && std::none_of(last, w.end(), odd));
+        assert(last - w.begin() == std::count_if(v.begin(), v.end(), odd));
+
+        w = v;
+        parallel::sort(pool, w);
+        auto sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        assert(w == sorted);
+        parallel::sort(pool, w, std::greater<>{});
+        assert(std::equal(w.begin(), w.end(), sorted.rbegin()));
+
+        w = v;
+        parallel::radix_sort(pool, w);
+        assert(w == sorted);
+        struct record {
+            double key;
+            std::size_t index;
+        };
+        std::vector<record> records(size);
+        for(std::size_t i = 0; i < size; ++i)
+            records[i] = {static_cast<double>(v[i]) - 500.5, i};
+        parallel::radix_sort(pool, records, allocation::c_allocator, &record::key);
+        // stable, so equal keys keep their index order
+        assert(std::is_sorted(records.begin(), records.end(), [](auto & a, auto & b) {
+            return a.key < b.key || (a.key == b.key && a.index < b.index);
+        }));
+    }
+}
+
+static void test_spsc_ring()
+{
+    parallel::spsc_ring<std::unique_ptr<int>> ring{3};
+    assert(ring.capacity() == 4);
+    for(int i = 0; i < 4; ++i)
+        assert(ring.try_push(std::make_unique<int>(i)));
+    assert(!ring.try_emplace());
+    assert(*ring.try_pop().value() == 0);
+    std::unique_ptr<int> out[4];
+    assert(ring.try_pop_n(out, 4) == 3 && *out[2] == 3);
+    assert(!ring.try_pop());
+    // left over elements are destroyed with the ring
+    assert(ring.try_emplace(std::make_unique<int>(4)));
+
+    // batches reread the other side's index when the cached one leaves too little room
+    parallel::spsc_ring<int> ints{4};
+    int batch[4]{0, 1, 2};
+    assert(ints.try_push_n(batch, 3) == 3 && ints.try_pop_n(batch, 3) == 3);
+    assert(ints.try_push_n(batch, 4) == 4 && ints.try_pop_n(batch, 1) == 1);
+    assert(ints.try_push(5) && ints.try_pop_n(batch, 4) == 4 && batch[3] == 5);
+
+    constexpr std::uint64_t count = 100'000;
+    parallel::spsc_ring<std::uint64_t> numbers{64};
+    std::thread producer{[&] {
+        std::uint64_t batch[7];
+        for(std::uint64_t next = 0; next < count;) {
+            auto n = std::min<std::uint64_t>(count - next, 7);
+            std::iota(batch, batch + n, next);
+            if(auto pushed = numbers.try_push_n(batch, n))
+                next += pushed;
+            else
+                std::this_thread::yield();
+        }
+    }};
+    for(std::uint64_t expected = 0; expected < count;) {
+        std::uint64_t batch[5];
+        auto n = numbers.try_pop_n(batch, 5);
+        if(!n)
+            std::this_thread::yield();
+        for(std::size_t i = 0; i < n; ++i)
+            assert(batch[i] == expected++);
+    }
+    producer.join();
+}
+
+static void test_mpmc_queue()
+{
+    parallel::mpmc_queue<std::unique_ptr<int>> queue{4};
+    for(int i = 0; i < 4; ++i)
+        assert(queue.try_push(std::make_unique<int>(i)));
+    assert(!queue.try_emplace());
+    std::unique_ptr<int> out[8];
+    assert(queue.try_pop_n(out, 8) == 4 && *out[3] == 3);
+    assert(!queue.try_pop());
+    assert(queue.try_push_n(out, 8) == 4 && !out[0]);
+    assert(*queue.try_pop().value() == 0);
+
+    // every value is popped exactly once, and in order per producer
+    constexpr std::uint64_t producers = 4, consumers = 4, count = 50'000;
+    parallel::mpmc_queue<std::uint64_t> numbers{128};
+    std::atomic<std::uint64_t> popped{0}, sum{0};
+    std::vector<std::thread> threads;
+    for(std::uint64_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for(std::uint64_t i = 0; i < count;) {
+                std::uint64_t pushed;
+                if(i % 3) {
+                    pushed = numbers.try_push(p << 32 | i);
+                } else {
+                    std::uint64_t batch[3] = {p << 32 | i, p << 32 | (i + 1), p << 32 | (i + 2)};
+                    pushed = numbers.try_push_n(batch, std::min<std::uint64_t>(count - i, 3));
+                }
+                if(!pushed)
+                    std::this_thread::yield();
+                i += pushed;
+            }
+        });
+    }
+    for(std::uint64_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            std::uint64_t last[producers];
+            std::fill_n(last, producers, ~std::uint64_t{0});
+            std::uint64_t batch[4];
+            while(popped.load(std::memory_order_relaxed) < producers * count) {
+                auto n = numbers.try_pop_n(batch, 4);
+                if(!n)
+                    std::this_thread::yield();
+                for(std::size_t i = 0; i < n; ++i) {
+                    auto p = batch[i] >> 32, value = batch[i] & 0xffff'ffff;
+                    assert(last[p] == ~std::uint64_t{0} || last[p] < value);
+                    last[p] = value;
+                    sum.fetch_add(value, std::memory_order_relaxed);
+                }
+                popped.fetch_add(n, std::memory_order_relaxed);
+            }
+        });
+    }
+    for(auto & t : threads)
+        t.join();
+    assert(popped == producers * count);
+    assert(sum == producers * (count * (count - 1) / 2));
+}
+
+int main()
+{
+    test_spsc_ring();
+    test_mpmc_queue();
+    std::mt19937_64 rng{42};
+    for(std::size_t threads : {1, 2, 4}) {
+        parallel::thread_pool pool{threads, allocation::arena_size{4096}};
+        assert(pool.size() == threads);
+        test_join(pool);
+        test_algorithms(pool, rng);
+    }
+    std::vector<std::string> strings{"c", "a", "b"};
+    parallel::sort(strings);
+    assert((strings == std::vector<std::string>{"a", "b", "c"}));
+    std::vector<int> ones(10'000, 1);
+    assert(parallel::transform_reduce(ones, 0, std::plus<>{}, [](int x) { return x; }) == 10'000);
+}
@@ -20,6 +20,16 @@ static_assert(ranges::rend(array2) == array2.rend());
 static_assert(ranges::size(array2) == array2.size());
 static_assert(!ranges::empty(array2));
 static_assert(ranges::empty(std::array<int, 0>{}));
+static_assert(ranges::data(array) == array && ranges::cdata(array) == array);
+static_assert(ranges::data(array2) == array2.data());
+static_assert(ranges::contiguous_range<decltype(array)> && ranges::contiguous_range<std::array<int, 5>>);
+static_assert(ranges::sized_range<decltype(array)> && ranges::sized_range<std::array<int, 5>>);
+
+inline constexpr std::array array3{1, 2, 3, 4, 5};
+static_assert(ranges::find(array3, 3) == array3.begin() + 2 && ranges::find(array3, 6) == array3.end());
+static_assert(ranges::count(array3, 3) == 1 && ranges::min(array3) == 1 && ranges::max(array3) == 5);
+static_assert(ranges::equal(array3, array3) && !ranges::equal(array3, std::array{1, 2, 3}));
+static_assert(ranges::mismatch(array3, std::array{1, 2, 4}).first == array3.begin() + 2);
 
 namespace test {
     static constinit char test[]        = "test";
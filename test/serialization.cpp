@@ -0,0 +1,65 @@
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <serialization.hpp>
+#include <vector>
+
+using namespace gstd::serialization;
+using gstd::meta::type_sequence::type_sequence;
+
+enum class color : std::uint16_t { red = 1, green = 2 };
+
+using schema = type_sequence<std::uint8_t, std::uint32_t, color, double, std::array<char, 3>>;
+using layout = flat_layout<schema>;
+
+static_assert(layout::offsets == std::array<size_t, 5>{0, 4, 8, 16, 24});
+static_assert(layout::size == 32 && layout::alignment == 8);
+static_assert(layout::run_count == 1 && layout::verbatim); // little-endian host with natural alignment
+static_assert(flat_layout<type_sequence<std::uint64_t, char>>::sparse); // trailing padding
+static_assert(!flat_layout<type_sequence<std::uint32_t, std::uint32_t>>::sparse);
+static_assert(!wire_type<long double> && !wire_type<int *> && wire_type<std::byte[4]>);
+
+static void test_round_trip()
+{
+    flat_record<schema> rec{7, 0x01020304, color::green, 1.5, {'a', 'b', 'c'}};
+    alignas(layout::alignment) std::byte bytes[layout::size];
+    assert(serialize(rec, bytes) == bytes + layout::size);
+
+    unsigned char const expected[]{7, 0, 0, 0, 4, 3, 2, 1, 2, 0};
+    assert(std::memcmp(bytes, expected, sizeof expected) == 0);
+
+    flat_view<schema> view{bytes};
+    assert(view.get<0>() == 7 && view.get<1>() == 0x01020304 && view.get<2>() == color::green);
+    assert(view.get<3>() == 1.5 && view.get<4>()[2] == 'c');
+
+    flat_record<schema> copy;
+    deserialize(bytes, copy);
+    auto & [a, b, c, d, e] = copy;
+    assert(a == 7 && b == 0x01020304 && c == color::green && d == 1.5 && e[0] == 'a');
+}
+
+static void test_many()
+{
+    std::vector<flat_record<schema>> recs(100);
+    for(std::uint32_t i = 0; i < recs.size(); ++i)
+        recs[i].get<1>() = i;
+    std::vector<std::byte> bytes(recs.size() * layout::size);
+    serialize(std::span<flat_record<schema> const>{recs}, bytes.data());
+    flat_view<schema> view{bytes.data()};
+    for(std::uint32_t i = 0; i < recs.size(); ++i)
+        assert(view[i].get<1>() == i && view[i].get<0>() == 0);
+
+    using packed = type_sequence<char, std::uint64_t, std::uint16_t>;
+    flat_record<packed> rec{'x', 42, 7};
+    std::byte out[flat_layout<packed>::size];
+    std::memset(out, 0xff, sizeof out);
+    serialize(rec, out);
+    assert(out[1] == std::byte{0} && flat_view<packed>{out}.get<2>() == 7);
+}
+
+int main()
+{
+    test_round_trip();
+    test_many();
+}
@@ -0,0 +1,131 @@
+#include <allocation.hpp>
+#include <cassert>
+#include <cstdint>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace gstd;
+
+struct node {
+    std::uint64_t value;
+    allocation::offset_ptr<node> next;
+};
+
+static void test_offset_ptr()
+{
+    allocation::offset_ptr<int> null;
+    assert(!null && null.get() == nullptr && null == nullptr);
+    int values[4] = {1, 2, 3, 4};
+    allocation::offset_ptr<int> p = values;
+    assert(p && *p == 1 && p[3] == 4);
+    // copies point to the same object from elsewhere
+    auto * copy = new allocation::offset_ptr<int>{p};
+    assert(copy->get() == values);
+    ++*copy;
+    assert(**copy == 2 && *copy - p == 1 && p < *copy);
+    *copy = nullptr;
+    assert(!*copy);
+    delete copy;
+    allocation::offset_ptr<void const> erased = allocation::offset_ptr<int>{values + 2};
+    assert(erased.get() == values + 2);
+}
+
+// sums a list built by another mapping
+static std::uint64_t sum(allocation::shared_memory_allocator const & region)
+{
+    std::uint64_t total = 0;
+    for(auto * n = static_cast<node *>(region.root()); n; n = n->next.get())
+        total += n->value;
+    return total;
+}
+
+int main()
+{
+    test_offset_ptr();
+
+    char const * name = "/gstd_test_shared_memory";
+    allocation::shared_memory_allocator::remove(name);
+    allocation::shared_memory_allocator region{name, 1 << 20};
+    assert(region.size() == 1 << 20 && !region.root());
+    bool thrown = false;
+    try {
+        allocation::shared_memory_allocator again{name, 1 << 20};
+    } catch(std::system_error const &) {
+        thrown = true;
+    }
+    assert(thrown);
+
+    node * head = nullptr;
+    for(std::uint64_t i = 1; i <= 1000; ++i) {
+        auto allocation = region.allocate(sizeof(node));
+        assert(allocation && allocation.size >= sizeof(node) && region.owns(allocation));
+        assert(reinterpret_cast<std::uintptr_t>(allocation.ptr) % alignof(std::max_align_t) == 0);
+        head = ::new(allocation.ptr) node{i, head};
+    }
+    region.set_root(head);
+
+    // another mapping of the same memory is at a different address
+    allocation::shared_memory_allocator reader{name, allocation::shared_access::read_only};
+    assert(reader.root() != region.root() && sum(reader) == 1000 * 1001 / 2);
+    assert(!reader.allocate(16) && !reader.owns(region.allocate(16)));
+    // deallocating through a read-only mapping doesn't write to it
+    reader.deallocate({static_cast<char *>(reader.root()) - 64, 64});
+    assert(sum(reader) == 1000 * 1001 / 2);
+
+    // and so is the one of another process
+    auto child = ::fork();
+    if(child == 0) {
+        allocation::shared_memory_allocator mapped{name, allocation::shared_access::read_only};
+        ::_exit(sum(mapped) == 1000 * 1001 / 2 ? 0 : 1);
+    }
+    int status;
+    assert(::waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    // freed blocks are reused by every mapping
+    auto block = region.allocate(100);
+    assert(block.size == 128);
+    region.deallocate(block);
+    allocation::shared_memory_allocator writer{name};
+    auto reused = writer.allocate(128);
+    assert(static_cast<char *>(reused.ptr) - static_cast<char *>(writer.root())
+           == static_cast<char *>(block.ptr) - static_cast<char *>(region.root()));
+    writer.deallocate(reused);
+
+    // concurrent allocation through different mappings never hands out a block twice
+    std::vector<std::thread> threads;
+    std::vector<allocation::shared_memory_allocator> mappings;
+    for(int t = 0; t < 4; ++t)
+        mappings.emplace_back(name);
+    for(auto & mapping : mappings) {
+        threads.emplace_back([&mapping] {
+            std::vector<allocation::allocation_result> mine;
+            for(int round = 0; round < 200; ++round) {
+                for(std::uint64_t i = 0; i < 16; ++i) {
+                    auto allocation = mapping.allocate(48);
+                    assert(allocation);
+                    *static_cast<std::uint64_t *>(allocation.ptr) = i;
+                    mine.push_back(allocation);
+                }
+                for(std::uint64_t i = 0; i < 16; ++i)
+                    assert(*static_cast<std::uint64_t *>(mine[i].ptr) == i);
+                for(auto allocation : mine)
+                    mapping.deallocate(allocation);
+                mine.clear();
+            }
+        });
+    }
+    for(auto & t : threads)
+        t.join();
+    assert(sum(reader) == 1000 * 1001 / 2);
+    // moved from mappings are empty
+    auto moved = std::move(mappings.back());
+    assert(!mappings.back().allocate(16) && !mappings.back().root() && moved.allocate(16));
+
+    assert(allocation::shared_memory_allocator::remove(name));
+    assert(!allocation::shared_memory_allocator::remove(name));
+}
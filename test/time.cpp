@@ -1,9 +1,15 @@
+#include <cassert>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 #include <time.hpp>
 
-using gstd::time::debug_timer;
+using namespace gstd::time;
 
 static void test_debug_timer() noexcept
 {
@@ -19,8 +25,216 @@ static void test_debug_timer_unnamed() noexcept
     std::cout << "Test debug_timer unnamed (2s):\n";
 }
 
+// has to run first, before anything converted ticks
+static void test_lazy_calibration()
+{
+    // reading the counter doesn't wait for the rate to be measured
+    auto start = std::chrono::steady_clock::now();
+    (void) tsc_clock::ticks<fence::start>();
+    assert(std::chrono::steady_clock::now() - start < std::chrono::milliseconds{10});
+    tsc_clock::calibrate();
+    assert(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{tsc_clock::invariant() ? 20 : 0});
+}
+
+static void test_tsc_clock()
+{
+    std::cout << "tsc_clock invariant: " << tsc_clock::invariant() << '\n';
+    auto steady = std::chrono::steady_clock::now().time_since_epoch();
+    auto tsc    = tsc_clock::now().time_since_epoch();
+    assert(std::chrono::abs(tsc - steady) < std::chrono::milliseconds{1});
+    auto previous = tsc_clock::now();
+    for(int i = 0; i < 1000; ++i) {
+        auto now = tsc_clock::now<fence::start>();
+        assert(now >= previous);
+        previous = now;
+    }
+
+    tsc_clock::duration total{};
+    {
+        cycle_timer timer{total};
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+        assert(timer.elapsed() >= std::chrono::milliseconds{50});
+    }
+    {
+        cycle_timer timer{total};
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    }
+    assert(total >= std::chrono::milliseconds{100} && total < std::chrono::milliseconds{200});
+}
+
+static void test_histogram()
+{
+    static_assert(histogram::index(255) == 255 && histogram::index(256) == 256 && histogram::index(257) == 256);
+    static_assert(histogram::highest(histogram::index(histogram::max_value)) == histogram::max_value);
+    static_assert(histogram::index(histogram::max_value) == histogram::buckets - 1);
+    for(std::uint64_t v = 1; v < histogram::max_value; v = v * 3 + 1) {
+        auto i = histogram::index(v);
+        assert(v <= histogram::highest(i) && (!i || v > histogram::highest(i - 1)));
+        assert(histogram::highest(i) - v <= v / 128);
+    }
+
+    histogram h;
+    assert(h.quantile(0.5) == 0);
+    for(std::uint64_t v = 1; v <= 10'000; ++v)
+        h.record(v);
+    assert(h.count() == 10'000 && h.max() == 10'000);
+    auto near = [](std::uint64_t actual, std::uint64_t expected) {
+        return actual >= expected && actual - expected <= expected / 128;
+    };
+    assert(near(h.quantile(0.5), 5'000));
+    assert(near(h.quantile(0.99), 9'900));
+    assert(near(h.quantile(0.999), 9'990));
+    assert(h.quantile(1) == 10'000);
+}
+
+static void test_metrics()
+{
+    metrics registry;
+    auto & fast = registry["fast"];
+    assert(&registry["fast"] == &fast);
+    {
+        std::vector<std::jthread> threads;
+        for(int t = 0; t < 4; ++t)
+            threads.emplace_back([&] {
+                auto & slow = registry["slow"];
+                for(int i = 0; i < 10'000; ++i)
+                    fast.record(std::chrono::nanoseconds{i % 100});
+                for(int i = 0; i < 10; ++i) {
+                    scoped_timer timer{slow};
+                    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+                }
+            });
+    }
+    auto report = registry.report();
+    assert(report.size() == 2);
+    assert(report[0].name == "fast" && report[0].count == 40'000);
+    assert(report[0].p50 == std::chrono::nanoseconds{49} && report[0].max == std::chrono::nanoseconds{99});
+    assert(report[1].name == "slow" && report[1].count == 40);
+    assert(report[1].p50 >= std::chrono::milliseconds{1} && report[1].p99 <= report[1].max);
+    std::ostringstream os;
+    os << report[0];
+    assert(os.str() == "fast: 40000 p50 49ns p99 98ns p99.9 99ns max 99ns");
+
+    // destroyed after the thread's slots (it's constructed before them), so its sample is dropped
+    struct late_recorder {
+        ~late_recorder()
+        {
+            try {
+                m.record(std::chrono::nanoseconds{1});
+            } catch(std::runtime_error const &) {
+                dropped = true;
+            }
+        }
+
+        metrics::metric & m;
+        bool & dropped;
+    };
+
+    bool dropped = false;
+    std::thread{[&] {
+        thread_local late_recorder late{fast, dropped};
+        fast.reserve();
+    }}.join();
+    assert(dropped && registry.report()[0].count == 40'000);
+}
+
+static void test_logger()
+{
+    std::ostringstream os;
+    {
+        logger out{ostream_sink(os)};
+        {
+            std::vector<std::jthread> threads;
+            for(int t = 0; t < 4; ++t)
+                threads.emplace_back([&] {
+                    for(int i = 0; i < 500; ++i)
+                        logging_timer timer{out, "step"};
+                });
+        }
+        logging_timer timer{out, "total"};
+    }
+    std::istringstream lines{os.str()};
+    int steps = 0, totals = 0;
+    for(std::string line; std::getline(lines, line);) {
+        assert(line.ends_with("ns"));
+        steps += line.starts_with("step: ");
+        totals += line.starts_with("total: ");
+    }
+    assert(totals == 1 && steps == 2000);
+
+    char const * path = "/tmp/gstd_test_logger.log";
+    std::remove(path);
+    {
+        logger out{file_sink(path), std::chrono::milliseconds{1}};
+        logging_timer timer{out, "file"};
+    }
+    std::ifstream file{path};
+    std::string line;
+    assert(std::getline(file, line) && line.starts_with("file: "));
+    std::remove(path);
+
+    debug_timer timer{"streamed"};
+    std::ostringstream streamed;
+    streamed << timer;
+    assert(streamed.str().starts_with("streamed: "));
+}
+
+static void test_trace()
+{
+    auto count = [](std::string const & s, std::string const & needle) {
+        size_t n = 0;
+        for(auto i = s.find(needle); i != std::string::npos; i = s.find(needle, i + 1))
+            ++n;
+        return n;
+    };
+    {
+        GSTD_TRACE_SPAN("main \"quoted\"");
+        std::vector<std::jthread> threads;
+        for(int t = 0; t < 2; ++t)
+            threads.emplace_back([] {
+                for(int i = 0; i < 5000; ++i) {
+                    GSTD_TRACE_SPAN("outer");
+                    trace::span inner{"inner"};
+                }
+            });
+    }
+    std::ostringstream os;
+    trace::write(os);
+    auto json = os.str();
+    assert(json.starts_with("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[") && json.ends_with("]}\n"));
+    assert(count(json, "\"ph\":\"X\"") == 20'001);
+    assert(count(json, "\"name\":\"outer\"") == 10'000 && count(json, "\"name\":\"inner\"") == 10'000);
+    assert(count(json, "\"name\":\"main \\\"quoted\\\"\"") == 1);
+}
+
+static void test_perf_counters()
+{
+    perf_counter_group group;
+    perf_sample total;
+    std::uint64_t volatile sum = 0;
+    for(int run = 0; run < 2; ++run) {
+        scoped_counters counters{group, total};
+        for(std::uint64_t i = 0; i < 1'000'000; ++i)
+            sum = sum + i * i;
+    }
+    std::cout << "perf counters (" << sum << "): " << total << '\n';
+    assert(total.time > std::chrono::nanoseconds{0});
+    for(size_t i = 0; i < counter_count; ++i)
+        assert(total.available[i] == group.available(static_cast<counter>(i)));
+    if(group.available(counter::instructions))
+        assert(*total[counter::instructions] >= 2'000'000);
+    assert(total.ipc().has_value() == (group.available(counter::cycles) && group.available(counter::instructions)));
+}
+
 int main()
 {
+    test_lazy_calibration();
+    test_perf_counters();
+    test_trace();
+    test_logger();
+    test_histogram();
+    test_metrics();
+    test_tsc_clock();
     std::jthread t1{test_debug_timer};
     std::jthread t2{test_debug_timer_unnamed};
 }
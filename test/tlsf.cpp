@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <allocation.hpp>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace gstd;
+
+using tlsf = allocation::tlsf_allocator<allocation::c_allocator_type>;
+
+static_assert(allocation::reallocating_allocator<tlsf> && allocation::ownership_aware_allocator<tlsf>);
+
+static void fill(allocation::allocation_result allocation, unsigned char byte)
+{
+    std::memset(allocation.ptr, byte, allocation.size);
+}
+
+static bool filled(allocation::allocation_result allocation, size_t size, unsigned char byte)
+{
+    auto * bytes = static_cast<unsigned char *>(allocation.ptr);
+    return std::all_of(bytes, bytes + size, [=](unsigned char b) { return b == byte; });
+}
+
+static void test_basics()
+{
+    tlsf alloc{allocation::arena_size{1 << 16}};
+    auto a = alloc.allocate(1);
+    assert(a && a.size == 16 && alloc.owns(a));
+    assert(reinterpret_cast<std::uintptr_t>(a.ptr) % alignof(std::max_align_t) == 0);
+    auto b = alloc.allocate(1000);
+    assert(b && b.size >= 1000);
+    // everything but two headers can be handed out again once freed and coalesced
+    alloc.deallocate(a);
+    alloc.deallocate(b);
+    auto all = alloc.allocate((1 << 16) - 32);
+    assert(all && !alloc.allocate(1));
+    alloc.deallocate(all);
+
+    // grows in place into the following free block, moves otherwise
+    auto c = alloc.allocate(100);
+    fill(c, 0xc);
+    auto grown = alloc.reallocate(c, 4000);
+    assert(grown.ptr == c.ptr && grown.size >= 4000 && filled(grown, 100, 0xc));
+    auto blocker = alloc.allocate(16);
+    auto moved   = alloc.reallocate(grown, 8000);
+    assert(moved && moved.ptr != grown.ptr && filled(moved, 100, 0xc));
+    auto shrunk = alloc.reallocate(moved, 50);
+    assert(shrunk.ptr == moved.ptr && shrunk.size == 64);
+    assert(!alloc.reallocate(shrunk, 1 << 20) && filled(shrunk, 50, 0xc));
+    alloc.deallocate(shrunk);
+    alloc.deallocate(blocker);
+    all = alloc.allocate((1 << 16) - 32);
+    assert(all);
+    alloc.deallocate(all);
+
+    tlsf moved_from{allocation::arena_size{1024}};
+    tlsf moved_to{std::move(moved_from)};
+    // nothing of the pool (whose free block is in a list of the same first level) is left behind
+    assert(!moved_from.allocate(1) && !moved_from.allocate(600) && moved_to.allocate(900));
+}
+
+// random allocations and frees keep their contents, and free everything in the end
+static void test_random()
+{
+    constexpr size_t pool = 1 << 20;
+    tlsf alloc{allocation::arena_size{pool}};
+    std::mt19937_64 rng{42};
+    struct live {
+        allocation::allocation_result allocation;
+        size_t size;
+        unsigned char byte;
+    };
+    std::vector<live> blocks;
+    for(int i = 0; i < 100'000; ++i) {
+        auto op = rng() % 3;
+        if(op == 0 && !blocks.empty()) {
+            auto j = rng() % blocks.size();
+            assert(filled(blocks[j].allocation, blocks[j].size, blocks[j].byte));
+            alloc.deallocate(blocks[j].allocation);
+            blocks[j] = blocks.back();
+            blocks.pop_back();
+        } else if(op == 1 && !blocks.empty()) {
+            auto & b  = blocks[rng() % blocks.size()];
+            auto size = static_cast<size_t>(rng() % (rng() % 8 ? 256 : 16384));
+            if(auto r = alloc.reallocate(b.allocation, size)) {
+                assert(filled(r, std::min(b.size, size), b.byte));
+                b.allocation = r;
+                b.size       = size;
+                fill(r, b.byte);
+            }
+        } else {
+            auto size = static_cast<size_t>(rng() % (rng() % 8 ? 256 : 16384));
+            if(auto a = alloc.allocate(size)) {
+                assert(a.size >= size && a.size % 16 == 0 && alloc.owns(a));
+                auto byte = static_cast<unsigned char>(rng());
+                fill(a, byte);
+                blocks.push_back({a, size, byte});
+            }
+        }
+    }
+    for(auto & b : blocks)
+        alloc.deallocate(b.allocation);
+    auto all = alloc.allocate(pool - 32);
+    assert(all);
+}
+
+int main()
+{
+    test_basics();
+    test_random();
+}
@@ -0,0 +1,109 @@
+#include <allocation.hpp>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility/transaction.hpp>
+#include <vector>
+
+using namespace gstd;
+
+// appends `value` to `v` as one step of `tx`
+template<typename Tx>
+static void push(Tx & tx, std::vector<int> & v, int value)
+{
+    v.push_back(value);
+    tx.on_rollback([&v] { v.pop_back(); });
+}
+
+static void test_commit_and_rollback()
+{
+    std::vector<int> v;
+    {
+        utility::transaction tx;
+        for(int i = 0; i < 100; ++i)
+            push(tx, v, i);
+    }
+    assert(v.size() == 100);
+
+    try {
+        // small enough to spill into blocks from `c_allocator`
+        utility::transaction<64> tx;
+        for(int i = 0; i < 100; ++i)
+            push(tx, v, i);
+        assert(v.size() == 200);
+        throw 42;
+    } catch(int) {}
+    assert(v.size() == 100);
+
+    std::vector<int> order;
+    utility::transaction<32> tx;
+    for(int i = 0; i < 10; ++i)
+        tx.on_rollback([&order, i] { order.push_back(i); });
+    tx.rollback();
+    assert(tx.empty() && order == (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1, 0}));
+    tx.on_rollback([&order] { order.clear(); });
+    tx.commit();
+    assert(tx.empty() && order.size() == 10);
+}
+
+static void test_non_trivial_actions()
+{
+    auto shared = std::make_shared<std::string>("undo");
+    std::string log;
+    {
+        utility::transaction<128> tx;
+        for(int i = 0; i < 20; ++i)
+            tx.on_rollback([shared, &log] { log += *shared; });
+        assert(shared.use_count() == 21);
+        tx.commit();
+        assert(shared.use_count() == 1 && log.empty());
+        for(int i = 0; i < 3; ++i)
+            tx.on_rollback([shared, &log] { log += *shared; });
+        tx.rollback();
+        assert(shared.use_count() == 1 && log == "undoundoundo");
+    }
+}
+
+static void test_exhausted()
+{
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{256}};
+    std::vector<int> v;
+    try {
+        utility::transaction<64, decltype(arena)> tx{arena};
+        for(int i = 0; i < 1000; ++i)
+            push(tx, v, i);
+        assert(false);
+    } catch(std::bad_alloc const &) {}
+    // the failed step was undone right away, the others by unwinding
+    assert(v.empty());
+}
+
+// a transaction used while unwinding is only rolled back by a new exception
+struct cleanup {
+    ~cleanup()
+    {
+        utility::transaction tx;
+        push(tx, v, 1);
+    }
+
+    std::vector<int> & v;
+};
+
+static void test_during_unwinding()
+{
+    std::vector<int> v;
+    try {
+        cleanup c{v};
+        throw 42;
+    } catch(int) {}
+    assert(v.size() == 1);
+}
+
+int main()
+{
+    test_commit_and_rollback();
+    test_non_trivial_actions();
+    test_exhausted();
+    test_during_unwinding();
+}
@@ -0,0 +1,173 @@
+#include <allocation.hpp>
+#include <array>
+#include <cassert>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <map>
+#include <ranges.hpp>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+#include "counting_allocator.hpp"
+
+using namespace gstd;
+
+inline constexpr auto odd    = [](int x) { return x % 2 != 0; };
+inline constexpr auto square = [](int x) { return x * x; };
+
+template<typename R>
+static constexpr std::vector<int> collect(R && rng)
+{
+    std::vector<int> result;
+    for(auto && x : rng)
+        result.push_back(x);
+    return result;
+}
+
+static constexpr bool test_pipeline()
+{
+    std::vector v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    assert((collect(v | ranges::views::filter(odd)) == std::vector{1, 3, 5, 7, 9}));
+    assert((collect(v | ranges::views::transform(square) | ranges::views::take(3)) == std::vector{1, 4, 9}));
+    assert((collect(v | ranges::views::drop(7)) == std::vector{8, 9, 10}));
+    assert((collect(v | ranges::views::drop(20)).empty()));
+    assert((collect(v | ranges::views::take(20)) == v));
+    assert((collect(v | ranges::views::stride(3)) == std::vector{1, 4, 7, 10}));
+    assert((collect(ranges::views::stride(v, 5)) == std::vector{1, 6}));
+    auto pipeline = ranges::views::filter(odd) | ranges::views::transform(square) | ranges::views::drop(1);
+    assert((collect(v | pipeline) == std::vector{9, 25, 49, 81}));
+    assert((collect(pipeline(v) | ranges::views::take(2)) == std::vector{9, 25}));
+    // rvalues are moved into the view
+    assert((collect(std::vector{1, 2, 3} | ranges::views::transform(square)) == std::vector{1, 4, 9}));
+    for(auto && x : v | ranges::views::filter(odd))
+        x = 0;
+    assert((v == std::vector{0, 2, 0, 4, 0, 6, 0, 8, 0, 10}));
+
+    // the first match is searched for once, copies search again in their own range
+    int calls     = 0;
+    auto filtered = v | ranges::views::filter([&](int x) { return ++calls, x == 6; });
+    assert(*filtered.begin() == 6 && calls == 6);
+    assert(*filtered.begin() == 6 && calls == 6);
+    auto copy = filtered;
+    assert(*copy.begin() == 6 && calls == 12);
+    return true;
+}
+
+static_assert(test_pipeline());
+
+static constexpr bool test_zip_enumerate()
+{
+    std::array a{1, 2, 3, 4};
+    std::vector b{10, 20, 30};
+    int sum = 0;
+    for(auto [x, y] : ranges::views::zip(a, b))
+        sum += x * y;
+    assert(sum == 10 + 40 + 90);
+    for(auto [x, y] : ranges::views::zip(a, b))
+        y = x;
+    assert((b == std::vector{1, 2, 3}));
+    size_t expected = 0;
+    for(auto [i, x] : a | ranges::views::enumerate) {
+        assert(i == expected++ && x == a[i]);
+        x = 0;
+    }
+    assert(expected == 4 && a == (std::array{0, 0, 0, 0}));
+    return true;
+}
+
+static_assert(test_zip_enumerate());
+
+// chains over sized random-access ranges stay sized and random-access
+using vec_ref = std::vector<int> &;
+static_assert(ranges::view<ranges::all_t<vec_ref>> && ranges::view<ranges::all_t<std::vector<int>>>);
+static_assert(ranges::random_access_range<decltype(std::declval<vec_ref>() | ranges::views::transform(square))>);
+static_assert(ranges::sized_range<decltype(std::declval<vec_ref>() | ranges::views::transform(square))>);
+static_assert(std::same_as<ranges::iterator_t<decltype(std::declval<vec_ref>() | ranges::views::take(1))>,
+                           std::vector<int>::iterator>);
+static_assert(std::same_as<ranges::iterator_t<decltype(std::declval<vec_ref>() | ranges::views::drop(1))>,
+                           std::vector<int>::iterator>);
+static_assert(ranges::forward_range<decltype(std::declval<vec_ref>() | ranges::views::filter(odd))>);
+static_assert(!ranges::sized_range<decltype(std::declval<vec_ref>() | ranges::views::filter(odd))>);
+static_assert(ranges::sized_range<std::list<int>> && !ranges::sized_range<std::forward_list<int>>);
+
+static_assert(ranges::to<std::vector<int>>(std::array{1, 2, 3}) == std::vector{1, 2, 3});
+static_assert(ranges::to<std::vector>(std::array{1, 2, 3} | ranges::views::transform(square)) == std::vector{1, 4, 9});
+
+template<typename R>
+static constexpr std::vector<std::string_view> fields(R && rng)
+{
+    std::vector<std::string_view> result;
+    for(auto field : rng)
+        result.push_back(field);
+    return result;
+}
+
+using namespace std::string_view_literals;
+static_assert(fields(""sv | ranges::views::split(',')).empty() && fields(""sv | ranges::views::lines).empty());
+static_assert(fields("a,,b,"sv | ranges::views::split(',')) == std::vector{"a"sv, ""sv, "b"sv, ""sv});
+static_assert(fields(ranges::views::split(","sv, ',')) == std::vector{""sv, ""sv});
+static_assert(fields("x\ny\n"sv | ranges::views::lines) == std::vector{"x"sv, "y"sv});
+static_assert(fields("x\n\ny"sv | ranges::views::lines) == std::vector{"x"sv, ""sv, "y"sv});
+
+static void test_to()
+{
+    std::list l{1, 2, 3, 4, 5, 6};
+    counting_allocator counter;
+    auto v = ranges::to<std::vector>(l | ranges::views::transform(square), counter);
+    static_assert(std::same_as<decltype(v), std::vector<int, allocation::std_adapter<int, counting_allocator>>>);
+    assert((std::ranges::equal(v, std::vector{1, 4, 9, 16, 25, 36}) && counter.allocations == 1));
+    using counted_vector = std::vector<int, allocation::std_adapter<int, counting_allocator>>;
+    auto w               = l | ranges::views::drop(2) | ranges::to<counted_vector>(counter);
+    assert((std::ranges::equal(w, std::vector{3, 4, 5, 6}) && counter.allocations == 2));
+    assert(&w.get_allocator().get() == &counter);
+
+    allocation::arena_allocator<allocation::c_allocator_type> arena{allocation::arena_size{1024}};
+    std::vector<int> source{1, 2, 3, 4};
+    auto copy = source | ranges::to<std::vector>(arena);
+    assert(copy == (std::vector<int, allocation::std_adapter<int, decltype(arena)>>{{1, 2, 3, 4}, arena}));
+    assert(arena.owns({copy.data(), sizeof(int)}));
+
+    auto odd_set = l | ranges::views::filter(odd) | ranges::to<std::set>();
+    assert((odd_set == std::set{1, 3, 5}));
+    // the allocator goes after the comparison/hash
+    auto counted_set = l | ranges::to<std::set>(counter);
+    static_assert(std::same_as<decltype(counted_set)::key_compare, std::less<int>>);
+    assert(counted_set.size() == 6 && counter.allocations == 8);
+    auto counted_hashes = l | ranges::to<std::unordered_set>(counter);
+    assert(counted_hashes.contains(6) && &counted_hashes.get_allocator().get() == &counter);
+    std::vector<std::pair<int, char>> pairs{{2, 'b'}, {1, 'a'}};
+    auto counted_map = ranges::to<std::map>(pairs, counter);
+    static_assert(std::same_as<decltype(counted_map)::mapped_type, char>);
+    assert(counted_map.begin()->second == 'a');
+    auto d = ranges::to<std::deque<int>>(source);
+    assert((d == std::deque{1, 2, 3, 4}));
+    auto s = ranges::to<std::string>(std::vector{'a', 'b', 'c'});
+    assert(s == "abc");
+}
+
+int main()
+{
+    test_to();
+    // non-random-access and non-common ranges
+    std::list l{1, 2, 3, 4, 5, 6};
+    assert((collect(l | ranges::views::take(4) | ranges::views::drop(1)) == std::vector{2, 3, 4}));
+    assert((collect(l | ranges::views::stride(4)) == std::vector{1, 5}));
+    std::forward_list f{1, 2, 3, 4, 5};
+    assert((collect(f | ranges::views::filter(odd) | ranges::views::transform(square)) == std::vector{1, 9, 25}));
+    int sum = 0;
+    for(auto [x, y] : ranges::views::zip(l, f))
+        sum += x + y;
+    assert(sum == 2 + 4 + 6 + 8 + 10);
+    size_t n = 0;
+    for(auto [i, x] : f | ranges::views::enumerate)
+        n += i * static_cast<size_t>(x);
+    assert(n == 0 + 2 + 6 + 12 + 20);
+    std::vector<std::string> strings{"a", "bb", "ccc"};
+    auto lengths = strings | ranges::views::transform([](std::string const & s) { return s.size(); });
+    assert(ranges::size(lengths) == 3 && *(lengths.begin() + 2) == 3);
+    assert((ranges::views::take(l, 3).size() == 3 && ranges::views::drop(l, 4).size() == 2));
+    assert((ranges::views::stride(l, 4).size() == 2 && ranges::views::zip(l, std::vector{1, 2}).size() == 2));
+}